@@ -22,8 +22,15 @@ public class OUUBlueprintValidation : ModuleRules
 			"BlueprintGraph",
 			"UnrealEd",
 			"Kismet",
+			"UMG",
 			"UMGEditor",
-			"Projects"
+			"Projects",
+			"DerivedDataCache",
+			"AssetRegistry",
+			"Json",
+			"ToolMenus",
+			"Slate",
+			"SlateCore"
 		});
 	}
 }
\ No newline at end of file
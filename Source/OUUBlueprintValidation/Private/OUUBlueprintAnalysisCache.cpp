@@ -0,0 +1,289 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintAnalysisCache.h"
+
+#include "Async/ParallelFor.h"
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "OUUBlueprintGraphSnapshot.h"
+#include "OUUBlueprintMetricsDerivedData.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+
+namespace OUU::BlueprintValidation
+{
+	static TUniquePtr<FGraphAnalysisCache> GGraphAnalysisCache;
+
+	void FGraphAnalysisCache::Startup()
+	{
+		GGraphAnalysisCache = TUniquePtr<FGraphAnalysisCache>(new FGraphAnalysisCache());
+	}
+
+	void FGraphAnalysisCache::Shutdown() { GGraphAnalysisCache.Reset(); }
+
+	FGraphAnalysisCache& FGraphAnalysisCache::Get()
+	{
+		check(IsInGameThread());
+		return *GGraphAnalysisCache;
+	}
+
+	FGraphAnalysisCache::FGraphAnalysisCache()
+	{
+		FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FGraphAnalysisCache::HandleObjectModified);
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FGraphAnalysisCache::HandlePostGarbageCollect);
+		// Undo/redo restores objects without modifying them, so we can't know which graphs were affected
+		FEditorDelegates::PostUndoRedo.AddRaw(this, &FGraphAnalysisCache::Reset);
+		GetMutableDefault<UOUUBlueprintValidationSettings>()->OnSettingChanged().AddRaw(
+			this,
+			&FGraphAnalysisCache::HandleSettingsChanged);
+	}
+
+	FGraphAnalysisCache::~FGraphAnalysisCache()
+	{
+		FCoreUObjectDelegates::OnObjectModified.RemoveAll(this);
+		FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+		FEditorDelegates::PostUndoRedo.RemoveAll(this);
+		if (UObjectInitialized())
+		{
+			Reset();
+			GetMutableDefault<UOUUBlueprintValidationSettings>()->OnSettingChanged().RemoveAll(this);
+		}
+	}
+
+	uint64 FGraphAnalysisCache::GetChangeStamp(const UEdGraph& Graph) const
+	{
+		const uint64* ChangeStamp = ChangeStamps.Find(&Graph);
+		return ChangeStamp ? *ChangeStamp : 0;
+	}
+
+	const FGraphMetrics* FGraphAnalysisCache::FindMetrics(const UEdGraph& Graph) const
+	{
+		const auto* Entry = FindValidEntry(Graph);
+		return Entry && Entry->Metrics.IsSet() ? &Entry->Metrics.GetValue() : nullptr;
+	}
+
+	void FGraphAnalysisCache::AddMetrics(UEdGraph& Graph, uint64 ChangeStamp, const FGraphMetrics& Metrics)
+	{
+		if (auto* Entry = FindOrAddValidEntry(Graph, ChangeStamp))
+		{
+			Entry->Metrics = Metrics;
+		}
+	}
+
+	void FGraphAnalysisCache::GetOrComputeMetrics(TConstArrayView<UEdGraph*> Graphs, TArray<FGraphMetrics>& OutMetrics)
+	{
+		auto Pending = BeginComputeMetrics(Graphs);
+		ComputePendingMetrics(Pending, std::atomic<bool>(false));
+		FinishComputeMetrics(Pending);
+		OutMetrics = MoveTemp(Pending.Metrics);
+	}
+
+	FGraphAnalysisCache::FPendingMetrics FGraphAnalysisCache::BeginComputeMetrics(TConstArrayView<UEdGraph*> Graphs)
+	{
+		FPendingMetrics Pending;
+		Pending.Graphs.Reserve(Graphs.Num());
+		Pending.Metrics.SetNum(Graphs.Num());
+
+		// Snapshots have to be taken on the game thread, but they don't reference any UObjects, so the metrics of all
+		// graphs can be computed in parallel afterwards.
+		// Graphs that are not in memory might still have been analyzed in a previous session. Their persistent keys are
+		// built from the snapshots, so metrics of graphs are never reused after e.g. a native function they call or a
+		// macro they use changed.
+		const bool UsePersistentCache = UOUUBlueprintValidationSettings::Get().UsePersistentMetricsCache;
+		for (int32 GraphIdx = 0; GraphIdx < Graphs.Num(); ++GraphIdx)
+		{
+			auto& Graph = *Graphs[GraphIdx];
+			Pending.Graphs.Add(&Graph);
+			const auto* CachedMetrics = FindMetrics(Graph);
+			FScopedBlueprintValidationTimer::AddGraph(Graph, CachedMetrics != nullptr);
+			if (CachedMetrics)
+			{
+				Pending.Metrics[GraphIdx] = *CachedMetrics;
+				continue;
+			}
+
+			Pending.UncachedGraphIndices.Add(GraphIdx);
+			Pending.UncachedChangeStamps.Add(GetChangeStamp(Graph));
+			const auto& Snapshot = Pending.Snapshots.Add_GetRef(BuildGraphSnapshot(Graph));
+			if (UsePersistentCache)
+			{
+				// Only issue the request here. Waiting for it is part of ComputePendingMetrics(), which may run on a
+				// background task.
+				const auto& DerivedDataKey = Pending.DerivedDataKeys.Add_GetRef(GetMetricsDerivedDataKey(Snapshot));
+				Pending.DerivedDataHandles.Add(RequestMetricsFromDerivedDataCache(DerivedDataKey));
+			}
+		}
+		return Pending;
+	}
+
+	void FGraphAnalysisCache::ComputePendingMetrics(FPendingMetrics& Pending, const std::atomic<bool>& Cancelled)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ComputePendingMetrics);
+		const int32 NumSnapshots = Pending.Snapshots.Num();
+
+		// Always collect the results of all requests, even if cancelled, so no request is leaked
+		TBitArray<> FoundInDerivedDataCache(false, NumSnapshots);
+		for (int32 SnapshotIdx = 0; SnapshotIdx < Pending.DerivedDataHandles.Num(); ++SnapshotIdx)
+		{
+			auto DerivedDataMetrics = WaitForMetricsFromDerivedDataCache(Pending.DerivedDataHandles[SnapshotIdx]);
+			if (DerivedDataMetrics.IsSet())
+			{
+				Pending.Metrics[Pending.UncachedGraphIndices[SnapshotIdx]] = DerivedDataMetrics.GetValue();
+				FoundInDerivedDataCache[SnapshotIdx] = true;
+			}
+		}
+		Pending.DerivedDataHandles.Reset();
+
+		ParallelFor(
+			TEXT("OUUBlueprintValidation.ComputeGraphMetrics"),
+			NumSnapshots,
+			// Graph sizes vary a lot, so don't make the batches too large
+			2,
+			[&](int32 SnapshotIdx) {
+				if (Cancelled || FoundInDerivedDataCache[SnapshotIdx])
+				{
+					return;
+				}
+				Pending.Metrics[Pending.UncachedGraphIndices[SnapshotIdx]] =
+					ComputeGraphMetrics(Pending.Snapshots[SnapshotIdx]);
+			},
+			EParallelForFlags::Unbalanced);
+
+		if (Cancelled)
+		{
+			return;
+		}
+		for (int32 SnapshotIdx = 0; SnapshotIdx < Pending.DerivedDataKeys.Num(); ++SnapshotIdx)
+		{
+			if (FoundInDerivedDataCache[SnapshotIdx] == false)
+			{
+				PutMetricsToDerivedDataCache(
+					Pending.DerivedDataKeys[SnapshotIdx],
+					Pending.Metrics[Pending.UncachedGraphIndices[SnapshotIdx]]);
+			}
+		}
+	}
+
+	void FGraphAnalysisCache::FinishComputeMetrics(const FPendingMetrics& Pending)
+	{
+		for (int32 SnapshotIdx = 0; SnapshotIdx < Pending.Snapshots.Num(); ++SnapshotIdx)
+		{
+			const int32 GraphIdx = Pending.UncachedGraphIndices[SnapshotIdx];
+			if (auto* Graph = Pending.Graphs[GraphIdx].Get())
+			{
+				AddMetrics(*Graph, Pending.UncachedChangeStamps[SnapshotIdx], Pending.Metrics[GraphIdx]);
+			}
+		}
+	}
+
+	const TArray<FDisallowedNodeFinding>* FGraphAnalysisCache::FindDisallowedNodes(const UEdGraph& Graph) const
+	{
+		const auto* Entry = FindValidEntry(Graph);
+		return Entry && Entry->DisallowedNodes.IsSet() ? &Entry->DisallowedNodes.GetValue() : nullptr;
+	}
+
+	void FGraphAnalysisCache::AddDisallowedNodes(
+		UEdGraph& Graph,
+		uint64 ChangeStamp,
+		TArray<FDisallowedNodeFinding>&& Findings)
+	{
+		if (auto* Entry = FindOrAddValidEntry(Graph, ChangeStamp))
+		{
+			Entry->DisallowedNodes = MoveTemp(Findings);
+		}
+	}
+
+	void FGraphAnalysisCache::Reset()
+	{
+		for (auto& Entry : Entries)
+		{
+			if (auto* Graph = Entry.Key.ResolveObjectPtr())
+			{
+				Graph->RemoveOnGraphChangedHandler(Entry.Value.OnGraphChangedHandle);
+			}
+		}
+		Entries.Reset();
+	}
+
+	const FGraphAnalysisCache::FEntry* FGraphAnalysisCache::FindValidEntry(const UEdGraph& Graph) const
+	{
+		const auto* Entry = Entries.Find(&Graph);
+		return Entry && Entry->ChangeStamp == GetChangeStamp(Graph) ? Entry : nullptr;
+	}
+
+	FGraphAnalysisCache::FEntry* FGraphAnalysisCache::FindOrAddValidEntry(UEdGraph& Graph, uint64 ChangeStamp)
+	{
+		if (ChangeStamp != GetChangeStamp(Graph))
+		{
+			return nullptr;
+		}
+
+		auto* Entry = Entries.Find(&Graph);
+		if (Entry == nullptr)
+		{
+			Entry = &Entries.Add(&Graph);
+			// Most modifications are already covered by HandleObjectModified, but e.g. adding or removing nodes is
+			// not guaranteed to modify the graph object itself.
+			Entry->OnGraphChangedHandle = Graph.AddOnGraphChangedHandler(
+				FOnGraphChanged::FDelegate::CreateRaw(this, &FGraphAnalysisCache::HandleGraphChanged));
+		}
+
+		if (Entry->ChangeStamp != ChangeStamp)
+		{
+			// Results from before the last change
+			Entry->Metrics.Reset();
+			Entry->DisallowedNodes.Reset();
+			Entry->ChangeStamp = ChangeStamp;
+		}
+		return Entry;
+	}
+
+	void FGraphAnalysisCache::MarkGraphChanged(const UEdGraph& Graph) { ChangeStamps.Add(&Graph, ++LastChangeStamp); }
+
+	void FGraphAnalysisCache::HandleObjectModified(UObject* Object)
+	{
+		if (auto* Graph = Cast<UEdGraph>(Object))
+		{
+			MarkGraphChanged(*Graph);
+		}
+		else if (auto* Node = Cast<UEdGraphNode>(Object))
+		{
+			// Also covers pin links and default values, which are modified via their owning nodes
+			if (auto* OwningGraph = Node->GetGraph())
+			{
+				MarkGraphChanged(*OwningGraph);
+			}
+		}
+	}
+
+	void FGraphAnalysisCache::HandleGraphChanged(const FEdGraphEditAction& Action)
+	{
+		if (Action.Graph)
+		{
+			MarkGraphChanged(*Action.Graph);
+		}
+	}
+
+	void FGraphAnalysisCache::HandleSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+	{
+		Reset();
+	}
+
+	void FGraphAnalysisCache::HandlePostGarbageCollect()
+	{
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (It->Key.ResolveObjectPtr() == nullptr)
+			{
+				It.RemoveCurrent();
+			}
+		}
+		for (auto It = ChangeStamps.CreateIterator(); It; ++It)
+		{
+			if (It->Key.ResolveObjectPtr() == nullptr)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+} // namespace OUU::BlueprintValidation
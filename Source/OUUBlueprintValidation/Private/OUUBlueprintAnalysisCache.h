@@ -0,0 +1,128 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "OUUBlueprintComplexity.h"
+#include "OUUBlueprintGraphSnapshot.h"
+#include "UObject/ObjectKey.h"
+
+#include <atomic>
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+namespace OUU::BlueprintValidation
+{
+	enum class EDisallowedNodeType : uint8
+	{
+		BlueprintCast,
+		DisallowedFunction
+	};
+
+	struct FDisallowedNodeFinding
+	{
+		TWeakObjectPtr<UEdGraphNode> Node;
+		EDisallowedNodeType Type = EDisallowedNodeType::BlueprintCast;
+		// Reason from the project settings. Only set for disallowed functions.
+		FString Reason;
+	};
+
+	// Find disallowed nodes in all graphs of a blueprint.
+	// Findings of unchanged graphs are reused from previous validations (e.g. compile before save).
+	void FindDisallowedNodes(const UBlueprint& Blueprint, TArray<FDisallowedNodeFinding>& OutFindings);
+
+	// In-memory cache of per-graph analysis results that is shared between the compiler extension and the asset
+	// validators, so e.g. a compile followed by a save does not analyze the same unchanged graphs twice.
+	// Results are stored together with the change stamp of the graph at the time of the analysis and are only returned
+	// as long as the graph was not modified since.
+	// Must only be used from the game thread.
+	class FGraphAnalysisCache
+	{
+	public:
+		// Called by the module
+		static void Startup();
+		static void Shutdown();
+
+		static FGraphAnalysisCache& Get();
+
+		~FGraphAnalysisCache();
+
+		// Stamp that changes whenever the graph or one of its nodes is modified.
+		// Capture it before analyzing a graph and pass it to the Add functions below, so results of graphs that were
+		// modified in the meantime are discarded.
+		uint64 GetChangeStamp(const UEdGraph& Graph) const;
+
+		const FGraphMetrics* FindMetrics(const UEdGraph& Graph) const;
+		void AddMetrics(UEdGraph& Graph, uint64 ChangeStamp, const FGraphMetrics& Metrics);
+
+		// Get the metrics of all graphs, either from the cache or by analyzing them.
+		// Graphs that are not cached are analyzed in parallel and added to the cache.
+		// All graphs must be blueprint graphs.
+		void GetOrComputeMetrics(TConstArrayView<UEdGraph*> Graphs, TArray<FGraphMetrics>& OutMetrics);
+
+		// Metrics computation of GetOrComputeMetrics() split into phases, so the analysis can run on a background task.
+		struct FPendingMetrics
+		{
+			TArray<TWeakObjectPtr<UEdGraph>> Graphs;
+			TArray<FGraphMetrics> Metrics;
+			// Graphs that were not cached when the computation was started
+			TArray<int32> UncachedGraphIndices;
+			TArray<uint64> UncachedChangeStamps;
+			TArray<FGraphSnapshot> Snapshots;
+			// Derived data cache key of each snapshot, so the computed metrics can be stored persistently.
+			// Empty if the persistent cache is disabled.
+			TArray<FString> DerivedDataKeys;
+			// Derived data cache request of each snapshot with a key
+			TArray<uint32> DerivedDataHandles;
+		};
+
+		// Look up cached metrics in memory, take snapshots of all other graphs and start looking them up in the
+		// derived data cache. Does not wait for the derived data cache. Game thread only.
+		FPendingMetrics BeginComputeMetrics(TConstArrayView<UEdGraph*> Graphs);
+
+		// Wait for the derived data cache, compute metrics of all graphs that were not found and store them in the
+		// derived data cache. Does not access any UObjects, so it's safe to call from any thread.
+		// Must be called exactly once for every FPendingMetrics. Stops early if Cancelled is set.
+		static void ComputePendingMetrics(FPendingMetrics& Pending, const std::atomic<bool>& Cancelled);
+
+		// Add the computed metrics to the cache. Game thread only.
+		void FinishComputeMetrics(const FPendingMetrics& Pending);
+
+		// Disallowed nodes depend on the project settings, so they are discarded whenever the settings change.
+		const TArray<FDisallowedNodeFinding>* FindDisallowedNodes(const UEdGraph& Graph) const;
+		void AddDisallowedNodes(UEdGraph& Graph, uint64 ChangeStamp, TArray<FDisallowedNodeFinding>&& Findings);
+
+		// Discard all cached results
+		void Reset();
+
+	private:
+		struct FEntry
+		{
+			uint64 ChangeStamp = 0;
+			TOptional<FGraphMetrics> Metrics;
+			TOptional<TArray<FDisallowedNodeFinding>> DisallowedNodes;
+			FDelegateHandle OnGraphChangedHandle;
+		};
+
+		FGraphAnalysisCache();
+
+		const FEntry* FindValidEntry(const UEdGraph& Graph) const;
+		// Returns nullptr if the change stamp is outdated
+		FEntry* FindOrAddValidEntry(UEdGraph& Graph, uint64 ChangeStamp);
+		void MarkGraphChanged(const UEdGraph& Graph);
+
+		void HandleObjectModified(UObject* Object);
+		void HandleGraphChanged(const FEdGraphEditAction& Action);
+		void HandleSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent);
+		void HandlePostGarbageCollect();
+
+		TMap<TObjectKey<UEdGraph>, FEntry> Entries;
+		// Last change stamp of every graph that was modified since the cache was created.
+		TMap<TObjectKey<UEdGraph>, uint64> ChangeStamps;
+		uint64 LastChangeStamp = 0;
+	};
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,348 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintAssetRegistryTags.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Hash/xxhash.h"
+#include "Misc/PackageName.h"
+#include "OUUBlueprintAnalysisCache.h"
+#include "OUUBlueprintBytecodeCostValidator.h"
+#include "OUUBlueprintComplexity.h"
+#include "OUUBlueprintDisallowedNodesValidator.h"
+#include "OUUBlueprintInstanceFootprintValidator.h"
+#include "OUUBlueprintLoopNestingValidator.h"
+#include "OUUBlueprintMaintainabilityValidator.h"
+#include "OUUBlueprintPerFrameCallsValidator.h"
+#include "OUUBlueprintPureReevaluationValidator.h"
+#include "OUUBlueprintValidationRules.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+#include "OUUBlueprintWidgetBindingsValidator.h"
+#include "UObject/AssetRegistryTagsContext.h"
+
+namespace OUU::BlueprintValidation
+{
+	namespace AssetRegistryTags
+	{
+		const FName WorstMaintainabilityIndex = TEXT("OUUBPV_WorstMaintainabilityIndex");
+		const FName MaxCyclomaticComplexity = TEXT("OUUBPV_MaxCyclomaticComplexity");
+		const FName MaxHalsteadVolume = TEXT("OUUBPV_MaxHalsteadVolume");
+		const FName GraphCount = TEXT("OUUBPV_GraphCount");
+		const FName DisallowedNodeCount = TEXT("OUUBPV_DisallowedNodeCount");
+		const FName Passed = TEXT("OUUBPV_Passed");
+		const FName ValidationStamp = TEXT("OUUBPV_ValidationStamp");
+	} // namespace AssetRegistryTags
+
+	static FDelegateHandle GGetExtraObjectTagsHandle;
+
+	// Verdicts of CanSkipValidation() during the current asset validation run, keyed by package name and saved hash.
+	// Every validator asks for each asset, but settings and dependencies don't change during a run, so the validation
+	// stamp only has to be computed once per asset.
+	static TMap<TPair<FName, FIoHash>, bool> GCanSkipValidationVerdicts;
+	static bool GIsAssetValidationRunning = false;
+	// Loaded blueprints that were not skipped during the current asset validation run
+	static TSet<TWeakObjectPtr<const UBlueprint>> GValidatedBlueprints;
+
+	// Summaries of the last asset validation runs by package name, written to the tags when the package is saved.
+	// Removed as soon as anything in the package is modified, so only summaries of the saved state are written.
+	static TMap<FName, FBlueprintValidationSummary> GRecentSummaries;
+	static FDelegateHandle GObjectModifiedHandle;
+
+	static void HandlePreAssetValidation()
+	{
+		GIsAssetValidationRunning = true;
+		GCanSkipValidationVerdicts.Reset();
+		GValidatedBlueprints.Reset();
+	}
+
+	static void HandlePostAssetValidation()
+	{
+		GIsAssetValidationRunning = false;
+		GCanSkipValidationVerdicts.Reset();
+
+		// The metrics of the validated blueprints are cached now, so summarizing them is cheap
+		for (const auto& WeakBlueprint : GValidatedBlueprints)
+		{
+			if (const UBlueprint* Blueprint = WeakBlueprint.Get())
+			{
+				GRecentSummaries.Add(Blueprint->GetPackage()->GetFName(), SummarizeBlueprintValidation(*Blueprint));
+			}
+		}
+		GValidatedBlueprints.Reset();
+	}
+
+	static void HandleObjectModified(UObject* Object)
+	{
+		if (Object && GRecentSummaries.Num() > 0)
+		{
+			GRecentSummaries.Remove(Object->GetPackage()->GetFName());
+		}
+	}
+
+	static void AddValidationSummaryTags(FAssetRegistryTagsContext Context)
+	{
+		// Only update the tags when saving, so the tags always describe the saved state. Cooked builds don't need the
+		// tags.
+		if (Context.IsSaving() == false || IsRunningCookCommandlet())
+		{
+			return;
+		}
+
+		const auto* Blueprint = Cast<UBlueprint>(Context.GetObject());
+		if (Blueprint == nullptr || Blueprint->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			return;
+		}
+
+		// Saving must stay cheap, so blueprints are never validated here. Without a summary of an asset validation
+		// run since the last modification, the tags are left out and the blueprint is not skipped by later runs.
+		const auto* Summary = GRecentSummaries.Find(Blueprint->GetPackage()->GetFName());
+		if (Summary == nullptr)
+		{
+			return;
+		}
+
+		auto AddTag = [&](FName Name, FString&& Value, UObject::FAssetRegistryTag::ETagType Type) {
+			Context.AddTag(UObject::FAssetRegistryTag(Name, MoveTemp(Value), Type));
+		};
+		using ETagType = UObject::FAssetRegistryTag::ETagType;
+		AddTag(
+			AssetRegistryTags::WorstMaintainabilityIndex,
+			LexToString(Summary->WorstMaintainabilityIndex),
+			ETagType::TT_Numerical);
+		AddTag(
+			AssetRegistryTags::MaxCyclomaticComplexity,
+			LexToString(Summary->MaxCyclomaticComplexity),
+			ETagType::TT_Numerical);
+		AddTag(AssetRegistryTags::MaxHalsteadVolume, LexToString(Summary->MaxHalsteadVolume), ETagType::TT_Numerical);
+		AddTag(AssetRegistryTags::GraphCount, LexToString(Summary->GraphCount), ETagType::TT_Numerical);
+		AddTag(
+			AssetRegistryTags::DisallowedNodeCount,
+			LexToString(Summary->DisallowedNodeCount),
+			ETagType::TT_Numerical);
+		AddTag(AssetRegistryTags::Passed, LexToString(Summary->Passed), ETagType::TT_Alphabetical);
+		AddTag(AssetRegistryTags::ValidationStamp, CopyTemp(Summary->ValidationStamp), ETagType::TT_Hidden);
+	}
+
+	void RegisterAssetRegistryTags()
+	{
+		GGetExtraObjectTagsHandle =
+			UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.AddStatic(&AddValidationSummaryTags);
+		FEditorDelegates::OnPreAssetValidation.AddStatic(&HandlePreAssetValidation);
+		FEditorDelegates::OnPostAssetValidation.AddStatic(&HandlePostAssetValidation);
+		GObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&HandleObjectModified);
+	}
+
+	void UnregisterAssetRegistryTags()
+	{
+		UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.Remove(GGetExtraObjectTagsHandle);
+		GGetExtraObjectTagsHandle.Reset();
+		FEditorDelegates::OnPreAssetValidation.RemoveStatic(&HandlePreAssetValidation);
+		FEditorDelegates::OnPostAssetValidation.RemoveStatic(&HandlePostAssetValidation);
+		FCoreUObjectDelegates::OnObjectModified.Remove(GObjectModifiedHandle);
+		GObjectModifiedHandle.Reset();
+		GIsAssetValidationRunning = false;
+		GCanSkipValidationVerdicts.Reset();
+		GValidatedBlueprints.Reset();
+		GRecentSummaries.Reset();
+	}
+
+	// Hash of the saved state of all packages the blueprint depends on (parent classes, called functions, macro
+	// libraries, cast targets, ...), so validation results are outdated once one of them is saved again.
+	// Includes indirect dependencies, because e.g. the parent class of a called function's class can change the result
+	// without the direct dependency being saved again.
+	// Uses the asset registry, so it works without loading the blueprint.
+	static uint64 HashDependencyPackages(FName PackageName)
+	{
+		auto& AssetRegistry = IAssetRegistry::GetChecked();
+		TSet<FName> VisitedPackages = {PackageName};
+		TArray<FName> PendingPackages = {PackageName};
+		TArray<FName> AllDependencies;
+		TArray<FName> Dependencies;
+		while (PendingPackages.Num() > 0)
+		{
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(
+				PendingPackages.Pop(EAllowShrinking::No),
+				OUT Dependencies,
+				UE::AssetRegistry::EDependencyCategory::Package,
+				UE::AssetRegistry::EDependencyQuery::Hard);
+			for (FName Dependency : Dependencies)
+			{
+				bool AlreadyVisited = false;
+				VisitedPackages.Add(Dependency, &AlreadyVisited);
+				// Native classes only change with the binaries, which don't have a saved hash
+				if (AlreadyVisited == false && FPackageName::IsScriptPackage(Dependency.ToString()) == false)
+				{
+					AllDependencies.Add(Dependency);
+					PendingPackages.Add(Dependency);
+				}
+			}
+		}
+		AllDependencies.Sort([](FName A, FName B) { return A.LexicalLess(B); });
+
+		FXxHash64Builder HashBuilder;
+		for (FName Dependency : AllDependencies)
+		{
+			const auto PackageData = AssetRegistry.GetAssetPackageDataCopy(Dependency);
+			const FIoHash SavedHash = PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash::Zero;
+			const FString DependencyName = Dependency.ToString().ToLower();
+			HashBuilder.Update(*DependencyName, DependencyName.Len() * sizeof(TCHAR));
+			HashBuilder.Update(SavedHash.GetBytes(), sizeof(FIoHash::ByteArray));
+		}
+		return HashBuilder.Finalize().Hash;
+	}
+
+	FString GetValidationStamp(FName PackageName)
+	{
+		return FString::Printf(
+			TEXT("%i-%016llx-%016llx"),
+			GraphMetricsVersion,
+			FCompiledValidationRules::Get().GetSettingsHash(),
+			HashDependencyPackages(PackageName));
+	}
+
+	FBlueprintValidationSummary SummarizeBlueprintValidation(const UBlueprint& Blueprint)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_SummarizeAssetRegistryTags);
+		OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+		FScopedBlueprintValidationTimer Timer(Blueprint);
+		auto& Settings = UOUUBlueprintValidationSettings::Get();
+
+		FBlueprintValidationSummary Summary;
+		Summary.ValidationStamp = GetValidationStamp(Blueprint.GetPackage()->GetFName());
+
+		TArray<UEdGraph*> Graphs;
+		Blueprint.GetAllGraphs(OUT Graphs);
+		Summary.GraphCount = Graphs.Num();
+		Graphs.RemoveAll([](UEdGraph* Graph) { return Graph == nullptr || IsBlueprintGraph(*Graph) == false; });
+
+		TArray<FGraphMetrics> AllGraphMetrics;
+		FGraphAnalysisCache::Get().GetOrComputeMetrics(Graphs, OUT AllGraphMetrics);
+		for (int32 GraphIdx = 0; GraphIdx < AllGraphMetrics.Num(); ++GraphIdx)
+		{
+			const auto& Metrics = AllGraphMetrics[GraphIdx];
+			const double GraphComplexity = Settings.CyclomaticComplexityMode == EOUUCyclomaticComplexityMode::McCabe
+				? Metrics.McCabeCyclomaticComplexity
+				: Metrics.CyclomaticComplexity;
+			const int32 MaintainabilityIndex = FMath::RoundToInt(
+				ComputeMicrosoftMaintainabilityIndex(Metrics.Halstead.Volume, GraphComplexity, Metrics.LinesOfCode));
+
+			Summary.WorstMaintainabilityIndex = GraphIdx == 0
+				? MaintainabilityIndex
+				: FMath::Min(Summary.WorstMaintainabilityIndex, MaintainabilityIndex);
+			Summary.MaxCyclomaticComplexity =
+				FMath::Max(Summary.MaxCyclomaticComplexity, FMath::RoundToInt(GraphComplexity));
+			Summary.MaxHalsteadVolume =
+				FMath::Max(Summary.MaxHalsteadVolume, FMath::RoundToInt(Metrics.Halstead.Volume));
+		}
+
+		// Metrics are cached, so running the validators on top of the summary above is cheap.
+		// The validators already reported the diagnostics, so they are not annotated on the nodes (see AnnotateNode()).
+		Summary.Passed = true;
+		// Only the severity is needed, so no message text is formatted for diagnostics
+		auto CheckDiagnostic = [&Summary](const FDiagnostic& Diagnostic) {
+			if (Diagnostic.Severity != EMessageSeverity::Info)
+			{
+				Summary.Passed = false;
+			}
+		};
+		UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(Blueprint, CheckDiagnostic, false);
+		if (Settings.CheckBytecodeCost != EOUUBlueprintValidationSeverity::DoNotValidate)
+		{
+			UOUUBlueprintBytecodeCostValidator::ValidateBytecodeCost(Blueprint, CheckDiagnostic, false);
+		}
+		UOUUBlueprintInstanceFootprintValidator::ValidateInstanceFootprint(Blueprint, CheckDiagnostic, false);
+		UOUUBlueprintWidgetBindingsValidator::ValidateWidgetBindings(Blueprint, CheckDiagnostic, false);
+		UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(Blueprint, [&](const FDiagnostic& Diagnostic) {
+			// Every disallowed node is reported with exactly one diagnostic
+			Summary.DisallowedNodeCount++;
+			CheckDiagnostic(Diagnostic);
+		});
+		UOUUBlueprintPerFrameCallsValidator::ValidatePerFrameCalls(Blueprint, CheckDiagnostic);
+		UOUUBlueprintPureReevaluationValidator::ValidatePureReevaluation(Blueprint, CheckDiagnostic);
+		UOUUBlueprintLoopNestingValidator::ValidateLoopNesting(Blueprint, CheckDiagnostic);
+
+		return Summary;
+	}
+
+	TOptional<FBlueprintValidationSummary> ReadValidationSummary(const FAssetData& AssetData)
+	{
+		FBlueprintValidationSummary Summary;
+		if (AssetData.GetTagValue(AssetRegistryTags::ValidationStamp, OUT Summary.ValidationStamp) == false)
+		{
+			return {};
+		}
+
+		// clang-format off
+		const bool HasAllTags =
+			AssetData.GetTagValue(AssetRegistryTags::WorstMaintainabilityIndex, OUT Summary.WorstMaintainabilityIndex)
+			&& AssetData.GetTagValue(AssetRegistryTags::MaxCyclomaticComplexity, OUT Summary.MaxCyclomaticComplexity)
+			&& AssetData.GetTagValue(AssetRegistryTags::MaxHalsteadVolume, OUT Summary.MaxHalsteadVolume)
+			&& AssetData.GetTagValue(AssetRegistryTags::GraphCount, OUT Summary.GraphCount)
+			&& AssetData.GetTagValue(AssetRegistryTags::DisallowedNodeCount, OUT Summary.DisallowedNodeCount)
+			&& AssetData.GetTagValue(AssetRegistryTags::Passed, OUT Summary.Passed);
+		// clang-format on
+		if (HasAllTags == false)
+		{
+			return {};
+		}
+		return Summary;
+	}
+
+	static bool CanSkipValidationBasedOnTags(const FAssetData& AssetData, const UObject* Asset)
+	{
+		// The metrics are only logged by the validators, so they must run
+		if (UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate
+			|| (Asset && Asset->GetPackage()->IsDirty()))
+		{
+			return false;
+		}
+
+		bool IsDataOnly = false;
+		if (AssetData.GetTagValue(FBlueprintTags::IsDataOnly, OUT IsDataOnly) && IsDataOnly)
+		{
+			return true;
+		}
+
+		const auto Summary = ReadValidationSummary(AssetData);
+		if (Summary.IsSet() == false || Summary->Passed == false)
+		{
+			return false;
+		}
+
+		if (GIsAssetValidationRunning == false)
+		{
+			return Summary->ValidationStamp == GetValidationStamp(AssetData.PackageName);
+		}
+
+		const auto PackageData = IAssetRegistry::GetChecked().GetAssetPackageDataCopy(AssetData.PackageName);
+		const FIoHash SavedHash = PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash::Zero;
+		const TPair<FName, FIoHash> VerdictKey{AssetData.PackageName, SavedHash};
+		if (const bool* Verdict = GCanSkipValidationVerdicts.Find(VerdictKey))
+		{
+			return *Verdict;
+		}
+		return GCanSkipValidationVerdicts.Add(
+			VerdictKey,
+			Summary->ValidationStamp == GetValidationStamp(AssetData.PackageName));
+	}
+
+	bool CanSkipValidation(const FAssetData& AssetData, const UObject* Asset)
+	{
+		const bool CanSkip = CanSkipValidationBasedOnTags(AssetData, Asset);
+		if (CanSkip == false && GIsAssetValidationRunning)
+		{
+			if (const auto* Blueprint = Cast<UBlueprint>(Asset))
+			{
+				GValidatedBlueprints.Add(Blueprint);
+			}
+		}
+		return CanSkip;
+	}
+} // namespace OUU::BlueprintValidation
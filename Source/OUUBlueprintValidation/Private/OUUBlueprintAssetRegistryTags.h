@@ -0,0 +1,64 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+class UBlueprint;
+
+namespace OUU::BlueprintValidation
+{
+	// Summary of the validation results of a blueprint.
+	// Written to the asset registry tags of blueprints that are saved after an asset validation run without being
+	// modified since, so batch validation and dashboards can query the results from FAssetData without loading the
+	// blueprints.
+	struct FBlueprintValidationSummary
+	{
+		int32 WorstMaintainabilityIndex = 0;
+		int32 MaxCyclomaticComplexity = 0;
+		int32 MaxHalsteadVolume = 0;
+		int32 GraphCount = 0;
+		int32 DisallowedNodeCount = 0;
+		// Did the blueprint pass validation without any warnings or errors?
+		bool Passed = false;
+		// Metrics version, validation rules and dependencies the summary was created with. See GetValidationStamp()
+		FString ValidationStamp;
+	};
+
+	namespace AssetRegistryTags
+	{
+		extern const FName WorstMaintainabilityIndex;
+		extern const FName MaxCyclomaticComplexity;
+		extern const FName MaxHalsteadVolume;
+		extern const FName GraphCount;
+		extern const FName DisallowedNodeCount;
+		extern const FName Passed;
+		extern const FName ValidationStamp;
+	} // namespace AssetRegistryTags
+
+	// Called by the module. Also tracks asset validation runs for CanSkipValidation() and the summaries of the
+	// blueprints validated by them.
+	void RegisterAssetRegistryTags();
+	void UnregisterAssetRegistryTags();
+
+	// Stamp of the current metrics version, validation rules and saved state of all dependencies of a package.
+	// Summaries with a different stamp are outdated.
+	// Dependencies are read from the asset registry, so dependencies that were added since the last save of the package
+	// change the stamp as well. Such blueprints are validated again until they are saved.
+	FString GetValidationStamp(FName PackageName);
+
+	// Validate the blueprint and summarize the results.
+	FBlueprintValidationSummary SummarizeBlueprintValidation(const UBlueprint& Blueprint);
+
+	// Read a summary from asset registry tags. Not set if the asset has no summary tags.
+	TOptional<FBlueprintValidationSummary> ReadValidationSummary(const FAssetData& AssetData);
+
+	// Can validation of a blueprint be skipped based on its asset registry tags?
+	// This is the case for data-only blueprints and blueprints that passed validation with the current rules when they
+	// were last saved. Blueprints with unsaved changes (dirty package of Asset) are never skipped, and neither is any
+	// blueprint while LogMetricsOnAssetValidate is enabled. All validators use this same rule.
+	// During an asset validation run, the verdict is only computed once per asset and reused for all validators.
+	// Loaded blueprints that are not skipped are summarized after the run, so their tags can be written on save.
+	bool CanSkipValidation(const FAssetData& AssetData, const UObject* Asset = nullptr);
+} // namespace OUU::BlueprintValidation
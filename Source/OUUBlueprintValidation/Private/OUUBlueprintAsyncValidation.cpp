@@ -0,0 +1,124 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintAsyncValidation.h"
+
+#include "Async/Async.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Logging/MessageLog.h"
+#include "OUUBlueprintAnalysisCache.h"
+#include "OUUBlueprintMaintainabilityValidator.h"
+#include "OUUBlueprintValidationCompilerExtension.h"
+#include "OUUBlueprintValidationUtils.h"
+
+namespace OUU::BlueprintValidation
+{
+	static TUniquePtr<FAsyncMaintainabilityValidation> GAsyncMaintainabilityValidation;
+
+	struct FAsyncMaintainabilityValidation::FPendingValidation
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		TSharedRef<FRequest, ESPMode::ThreadSafe> Request;
+		FGraphAnalysisCache::FPendingMetrics Metrics;
+		bool LogMetrics = false;
+	};
+
+	void FAsyncMaintainabilityValidation::Startup()
+	{
+		GAsyncMaintainabilityValidation =
+			TUniquePtr<FAsyncMaintainabilityValidation>(new FAsyncMaintainabilityValidation());
+	}
+
+	void FAsyncMaintainabilityValidation::Shutdown() { GAsyncMaintainabilityValidation.Reset(); }
+
+	FAsyncMaintainabilityValidation& FAsyncMaintainabilityValidation::Get()
+	{
+		check(IsInGameThread());
+		return *GAsyncMaintainabilityValidation;
+	}
+
+	FAsyncMaintainabilityValidation::~FAsyncMaintainabilityValidation()
+	{
+		CancelAll();
+		UE::Tasks::Wait(Tasks);
+	}
+
+	void FAsyncMaintainabilityValidation::Launch(UBlueprint& Blueprint, bool LogMetrics)
+	{
+		if (const auto* PreviousRequest = Requests.Find(&Blueprint))
+		{
+			// Results of the previous compilation are outdated
+			(*PreviousRequest)->Cancelled = true;
+		}
+		auto Request = MakeShared<FRequest, ESPMode::ThreadSafe>();
+		Requests.Add(&Blueprint, Request);
+
+		TArray<UEdGraph*> Graphs;
+		Blueprint.GetAllGraphs(OUT Graphs);
+		Graphs.RemoveAll([](UEdGraph* Graph) { return Graph == nullptr || IsBlueprintGraph(*Graph) == false; });
+
+		auto Validation = MakeShared<FPendingValidation, ESPMode::ThreadSafe>(FPendingValidation{
+			&Blueprint,
+			Request,
+			FGraphAnalysisCache::Get().BeginComputeMetrics(Graphs),
+			LogMetrics});
+
+		Tasks.RemoveAll([](const UE::Tasks::FTask& Task) { return Task.IsCompleted(); });
+		Tasks.Add(UE::Tasks::Launch(TEXT("OUUBlueprintValidation.ValidateMaintainability"), [Validation]() {
+			FGraphAnalysisCache::ComputePendingMetrics(Validation->Metrics, Validation->Request->Cancelled);
+			if (Validation->Request->Cancelled)
+			{
+				return;
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [Validation]() {
+				// The module might have been shut down in the meantime
+				if (GAsyncMaintainabilityValidation.IsValid())
+				{
+					GAsyncMaintainabilityValidation->Finish(*Validation);
+				}
+			});
+		}));
+	}
+
+	void FAsyncMaintainabilityValidation::CancelAll()
+	{
+		for (auto& Entry : Requests)
+		{
+			Entry.Value->Cancelled = true;
+		}
+		Requests.Reset();
+	}
+
+	void FAsyncMaintainabilityValidation::Finish(const FPendingValidation& Validation)
+	{
+		auto* Blueprint = Validation.Blueprint.Get();
+		if (Validation.Request->Cancelled || Blueprint == nullptr)
+		{
+			return;
+		}
+		Requests.Remove(Blueprint);
+
+		// Metrics of all graphs are cached now. Only graphs that were modified after the compilation are analyzed
+		// again by the validator.
+		FGraphAnalysisCache::Get().FinishComputeMetrics(Validation.Metrics);
+
+		TArray<TSharedRef<FTokenizedMessage>> Messages;
+		auto AddMessage = [&Messages](const FDiagnostic& Diagnostic) {
+			Messages.Add(MakeTokenizedMessage(Diagnostic));
+		};
+		UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(*Blueprint, AddMessage, Validation.LogMetrics);
+
+		// The other analyses need UObjects and are not cached, so they are not run on the background task. Running them
+		// here still keeps them out of the compilation.
+		UOUUBlueprintValidationCompilerExtension::ValidateCompiledBlueprint(
+			*Blueprint,
+			AddMessage,
+			Validation.LogMetrics);
+		if (Messages.Num() > 0)
+		{
+			FCompilerResultsLog::GetBlueprintMessageLog(Blueprint).AddMessages(Messages, false);
+		}
+	}
+} // namespace OUU::BlueprintValidation
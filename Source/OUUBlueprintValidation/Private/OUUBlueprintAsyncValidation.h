@@ -0,0 +1,52 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
+
+#include <atomic>
+
+class UBlueprint;
+
+namespace OUU::BlueprintValidation
+{
+	// Runs the maintainability validation of compiled blueprints on background tasks, so the metric analysis does not
+	// prolong blueprint compilation. Only the graph snapshots are taken and derived data cache lookups are issued
+	// during compilation. Waiting for the derived data cache is part of the background task.
+	// When the analysis is done, the remaining compile validations (except disallowed nodes) are run on the game thread
+	// and all messages are posted to the compiler results log of the blueprint.
+	// Pending validations are cancelled if the same blueprint is compiled again.
+	// Must only be used from the game thread.
+	class FAsyncMaintainabilityValidation
+	{
+	public:
+		// Called by the module
+		static void Startup();
+		static void Shutdown();
+
+		static FAsyncMaintainabilityValidation& Get();
+
+		~FAsyncMaintainabilityValidation();
+
+		void Launch(UBlueprint& Blueprint, bool LogMetrics);
+
+		void CancelAll();
+
+	private:
+		struct FRequest
+		{
+			std::atomic<bool> Cancelled = false;
+		};
+		struct FPendingValidation;
+
+		FAsyncMaintainabilityValidation() = default;
+
+		void Finish(const FPendingValidation& Validation);
+
+		TMap<TObjectKey<UBlueprint>, TSharedRef<FRequest, ESPMode::ThreadSafe>> Requests;
+		TArray<UE::Tasks::FTask> Tasks;
+	};
+} // namespace OUU::BlueprintValidation
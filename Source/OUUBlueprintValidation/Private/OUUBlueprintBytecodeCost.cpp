@@ -0,0 +1,398 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintBytecodeCost.h"
+
+#include "UObject/Class.h"
+#include "UObject/Script.h"
+#include "UObject/UnrealType.h"
+
+namespace OUU::BlueprintValidation
+{
+	static bool IsContainerProperty(const FProperty* Property)
+	{
+		return Property
+			&& (Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>());
+	}
+
+	// Walks the expressions of in-memory (i.e. linked) bytecode. The operand layout of each instruction follows
+	// FKismetBytecodeDisassembler::SerializeExpr(). Object and property operands are raw pointers in loaded bytecode.
+	class FBytecodeCostWalker
+	{
+	public:
+		explicit FBytecodeCostWalker(const TArray<uint8>& InScript) : Script(InScript)
+		{
+			Cost.ScriptSize = Script.Num();
+		}
+
+		FBytecodeCost Walk()
+		{
+			while (Cost.IsComplete && Offset < Script.Num())
+			{
+				if (ReadExpr() == EX_EndOfScript)
+				{
+					break;
+				}
+			}
+			return Cost;
+		}
+
+	private:
+		template <typename T>
+		T Read()
+		{
+			T Value{};
+			if (Offset + static_cast<int32>(sizeof(T)) > Script.Num())
+			{
+				Abort();
+				return Value;
+			}
+			FMemory::Memcpy(&Value, &Script[Offset], sizeof(T));
+			Offset += sizeof(T);
+			return Value;
+		}
+
+		void Skip(int32 NumBytes)
+		{
+			Offset += NumBytes;
+			if (Offset > Script.Num())
+			{
+				Abort();
+			}
+		}
+
+		void SkipName() { Skip(sizeof(FScriptName)); }
+		void SkipPointer() { Skip(sizeof(ScriptPointerType)); }
+		void SkipCodeOffset() { Skip(sizeof(CodeSkipSizeType)); }
+
+		template <typename PointerType>
+		PointerType* ReadPointer()
+		{
+			return reinterpret_cast<PointerType*>(Read<ScriptPointerType>());
+		}
+
+		void SkipAnsiString()
+		{
+			while (Cost.IsComplete && Read<ANSICHAR>() != 0) {}
+		}
+
+		void SkipUnicodeString()
+		{
+			while (Cost.IsComplete && Read<UTF16CHAR>() != 0) {}
+		}
+
+		void ReadExprsUntil(EExprToken EndToken)
+		{
+			while (Cost.IsComplete && ReadExpr() != EndToken) {}
+		}
+
+		void ReadFunctionCall(const UFunction* Function)
+		{
+			Cost.FunctionCalls++;
+			if (Function)
+			{
+				for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+				{
+					if (IsContainerProperty(*It) && It->HasAnyPropertyFlags(CPF_ReferenceParm) == false)
+					{
+						Cost.ContainerCopies++;
+					}
+				}
+			}
+			ReadExprsUntil(EX_EndFunctionParms);
+		}
+
+		void ReadAssignment(const FProperty* Property)
+		{
+			if (IsContainerProperty(Property))
+			{
+				Cost.ContainerCopies++;
+			}
+		}
+
+		void Abort()
+		{
+			Cost.IsComplete = false;
+			Offset = Script.Num();
+		}
+
+		EExprToken ReadExpr()
+		{
+			const auto Token = static_cast<EExprToken>(Read<uint8>());
+			if (Cost.IsComplete == false)
+			{
+				return EX_EndOfScript;
+			}
+			Cost.Instructions++;
+
+			switch (Token)
+			{
+			case EX_EndParmValue:
+			case EX_EndFunctionParms:
+			case EX_EndStructConst:
+			case EX_EndArray:
+			case EX_EndSet:
+			case EX_EndMap:
+			case EX_EndSetConst:
+			case EX_EndMapConst:
+			case EX_EndArrayConst:
+			case EX_EndOfScript:
+				// Markers, not instructions
+				Cost.Instructions--;
+				break;
+			case EX_Nothing:
+			case EX_Self:
+			case EX_IntZero:
+			case EX_IntOne:
+			case EX_True:
+			case EX_False:
+			case EX_NoObject:
+			case EX_NoInterface:
+			case EX_PopExecutionFlow:
+			case EX_DeprecatedOp4A:
+			case EX_Breakpoint:
+			case EX_WireTracepoint:
+			case EX_Tracepoint:
+				break;
+			case EX_LocalVariable:
+			case EX_InstanceVariable:
+			case EX_DefaultVariable:
+			case EX_LocalOutVariable:
+			case EX_ClassSparseDataVariable:
+			case EX_ObjectConst:
+			case EX_PropertyConst:
+				SkipPointer();
+				break;
+			case EX_NothingInt32:
+			case EX_IntConst:
+				Skip(sizeof(int32));
+				break;
+			case EX_FloatConst:
+				Skip(sizeof(float));
+				break;
+			case EX_DoubleConst:
+				Skip(sizeof(double));
+				break;
+			case EX_Int64Const:
+			case EX_UInt64Const:
+				Skip(sizeof(int64));
+				break;
+			case EX_ByteConst:
+			case EX_IntConstByte:
+				Skip(sizeof(uint8));
+				break;
+			case EX_VectorConst:
+			case EX_RotationConst:
+				Skip(3 * sizeof(double));
+				break;
+			case EX_Vector3fConst:
+				Skip(3 * sizeof(float));
+				break;
+			case EX_TransformConst:
+				// Rotation quaternion, translation, scale
+				Skip(10 * sizeof(double));
+				break;
+			case EX_StringConst:
+				SkipAnsiString();
+				break;
+			case EX_UnicodeStringConst:
+				SkipUnicodeString();
+				break;
+			case EX_NameConst:
+			case EX_InstanceDelegate:
+				SkipName();
+				break;
+			case EX_Jump:
+			case EX_PushExecutionFlow:
+			case EX_SkipOffsetConst:
+				SkipCodeOffset();
+				break;
+			case EX_BitFieldConst:
+				SkipPointer();
+				Skip(sizeof(uint8));
+				break;
+			case EX_Return:
+			case EX_ComputedJump:
+			case EX_PopExecutionFlowIfNot:
+			case EX_ClearMulticastDelegate:
+			case EX_SoftObjectConst:
+			case EX_FieldPathConst:
+				ReadExpr();
+				break;
+			case EX_InterfaceContext:
+				Cost.ContextSwitches++;
+				ReadExpr();
+				break;
+			case EX_JumpIfNot:
+			case EX_Skip:
+				SkipCodeOffset();
+				ReadExpr();
+				break;
+			case EX_Assert:
+				// Line number, debug only flag
+				Skip(sizeof(uint16) + sizeof(uint8));
+				ReadExpr();
+				break;
+			case EX_Cast:
+				// Conversion type
+				Skip(sizeof(uint8));
+				ReadExpr();
+				break;
+			case EX_MetaCast:
+			case EX_DynamicCast:
+			case EX_ObjToInterfaceCast:
+			case EX_CrossInterfaceCast:
+			case EX_InterfaceToObjCast:
+			case EX_StructMemberContext:
+				SkipPointer();
+				ReadExpr();
+				break;
+			case EX_LetValueOnPersistentFrame:
+				ReadAssignment(ReadPointer<FProperty>());
+				ReadExpr();
+				break;
+			case EX_Let:
+				ReadAssignment(ReadPointer<FProperty>());
+				ReadExpr();
+				ReadExpr();
+				break;
+			case EX_LetBool:
+			case EX_LetObj:
+			case EX_LetWeakObjPtr:
+			case EX_LetDelegate:
+			case EX_LetMulticastDelegate:
+			case EX_AddMulticastDelegate:
+			case EX_RemoveMulticastDelegate:
+			case EX_ArrayGetByRef:
+				ReadExpr();
+				ReadExpr();
+				break;
+			case EX_BindDelegate:
+				SkipName();
+				ReadExpr();
+				ReadExpr();
+				break;
+			case EX_Context:
+			case EX_Context_FailSilent:
+			case EX_ClassContext:
+				Cost.ContextSwitches++;
+				// Object expression, skip offset for null objects, r-value property, context expression
+				ReadExpr();
+				SkipCodeOffset();
+				SkipPointer();
+				ReadExpr();
+				break;
+			case EX_VirtualFunction:
+			case EX_LocalVirtualFunction:
+				// The function is only resolved by name at runtime
+				SkipName();
+				ReadFunctionCall(nullptr);
+				break;
+			case EX_FinalFunction:
+			case EX_LocalFinalFunction:
+			case EX_CallMath:
+			case EX_CallMulticastDelegate:
+				ReadFunctionCall(ReadPointer<UFunction>());
+				break;
+			case EX_StructConst:
+				// Struct, serialized size
+				SkipPointer();
+				Skip(sizeof(int32));
+				ReadExprsUntil(EX_EndStructConst);
+				break;
+			case EX_SetArray:
+				ReadExpr();
+				ReadExprsUntil(EX_EndArray);
+				break;
+			case EX_SetSet:
+				ReadExpr();
+				Skip(sizeof(int32));
+				ReadExprsUntil(EX_EndSet);
+				break;
+			case EX_SetMap:
+				ReadExpr();
+				Skip(sizeof(int32));
+				ReadExprsUntil(EX_EndMap);
+				break;
+			case EX_ArrayConst:
+				SkipPointer();
+				Skip(sizeof(int32));
+				ReadExprsUntil(EX_EndArrayConst);
+				break;
+			case EX_SetConst:
+				SkipPointer();
+				Skip(sizeof(int32));
+				ReadExprsUntil(EX_EndSetConst);
+				break;
+			case EX_MapConst:
+				SkipPointer();
+				SkipPointer();
+				Skip(sizeof(int32));
+				ReadExprsUntil(EX_EndMapConst);
+				break;
+			case EX_TextConst:
+				switch (static_cast<EBlueprintTextLiteralType>(Read<uint8>()))
+				{
+				case EBlueprintTextLiteralType::Empty:
+					break;
+				case EBlueprintTextLiteralType::LocalizedText:
+					// Source string, key, namespace
+					ReadExpr();
+					ReadExpr();
+					ReadExpr();
+					break;
+				case EBlueprintTextLiteralType::InvariantText:
+				case EBlueprintTextLiteralType::LiteralString:
+					ReadExpr();
+					break;
+				case EBlueprintTextLiteralType::StringTableEntry:
+					// String table asset, table id, key
+					SkipPointer();
+					ReadExpr();
+					ReadExpr();
+					break;
+				default:
+					Abort();
+					break;
+				}
+				break;
+			case EX_SwitchValue:
+			{
+				const uint16 NumCases = Read<uint16>();
+				// Offset to the end of the switch, index expression
+				SkipCodeOffset();
+				ReadExpr();
+				for (uint16 CaseIdx = 0; CaseIdx < NumCases && Cost.IsComplete; ++CaseIdx)
+				{
+					// Case value, offset to the next case, case result
+					ReadExpr();
+					SkipCodeOffset();
+					ReadExpr();
+				}
+				// Default result
+				ReadExpr();
+				break;
+			}
+			case EX_InstrumentationEvent:
+				if (Read<uint8>() == EScriptInstrumentation::InlineEvent)
+				{
+					SkipName();
+				}
+				break;
+			default:
+				// e.g. transactional instructions or instructions that were added in a newer engine version
+				Abort();
+				break;
+			}
+			return Token;
+		}
+
+		const TArray<uint8>& Script;
+		int32 Offset = 0;
+		FBytecodeCost Cost;
+	};
+
+	FBytecodeCost EstimateBytecodeCost(const UFunction& Function)
+	{
+		return FBytecodeCostWalker(Function.Script).Walk();
+	}
+} // namespace OUU::BlueprintValidation
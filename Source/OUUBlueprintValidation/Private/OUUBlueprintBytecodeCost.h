@@ -0,0 +1,33 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UFunction;
+
+namespace OUU::BlueprintValidation
+{
+	// Static estimate of the VM cost of a compiled blueprint function based on its bytecode.
+	// Nothing is executed, so loops and branches are not taken into account: Every instruction is counted once.
+	struct FBytecodeCost
+	{
+		// Number of expressions in the bytecode (excluding end markers of parameter lists, literals, etc)
+		int32 Instructions = 0;
+		// Expressions evaluated in the context of another object, e.g. calls to functions or property access of
+		// other objects
+		int32 ContextSwitches = 0;
+		// Calls of native functions, blueprint functions and delegates
+		int32 FunctionCalls = 0;
+		// Arrays, sets and maps that are copied by value, i.e. assignments of whole containers and containers that
+		// are passed to or returned from functions without reference
+		int32 ContainerCopies = 0;
+		// Size of the bytecode in bytes
+		int32 ScriptSize = 0;
+		// False if the bytecode contained an instruction that is not supported by the estimation.
+		// The counts are a lower bound in that case.
+		bool IsComplete = true;
+	};
+
+	FBytecodeCost EstimateBytecodeCost(const UFunction& Function);
+} // namespace OUU::BlueprintValidation
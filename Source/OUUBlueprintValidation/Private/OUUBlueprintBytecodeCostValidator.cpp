@@ -0,0 +1,130 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintBytecodeCostValidator.h"
+
+#include "EdGraph/EdGraph.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Misc/DataValidation.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintBytecodeCost.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+
+bool UOUUBlueprintBytecodeCostValidator::CanValidateAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& InContext) const
+{
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	return IsValid(Cast<UBlueprint>(InAsset))
+		&& Settings.CheckBytecodeCost != EOUUBlueprintValidationSeverity::DoNotValidate
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
+}
+
+EDataValidationResult UOUUBlueprintBytecodeCostValidator::ValidateLoadedAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& Context)
+{
+	const auto& Blueprint = *CastChecked<UBlueprint>(InAsset);
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	ValidateBytecodeCost(
+		Blueprint,
+		[&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+			Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+			if (Diagnostic.Severity != EMessageSeverity::Info)
+			{
+				Result = EDataValidationResult::Invalid;
+			}
+		},
+		UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+	return Result;
+}
+
+void UOUUBlueprintBytecodeCostValidator::ValidateBytecodeCost(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+	bool LogCosts)
+{
+	using namespace OUU::BlueprintValidation;
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidateBytecodeCost);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	FScopedBlueprintValidationTimer Timer(Blueprint);
+
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	auto* GeneratedClass = Cast<UBlueprintGeneratedClass>(Blueprint.GeneratedClass);
+	if (GeneratedClass == nullptr)
+	{
+		return;
+	}
+	const EMessageSeverity::Type FailureSeverity = ToMessageSeverity(Settings.CheckBytecodeCost);
+
+	for (TFieldIterator<UFunction> It(GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		const UFunction& Function = **It;
+		if (Function.Script.IsEmpty())
+		{
+			continue;
+		}
+
+		// All events of the event graphs are compiled into the ubergraph function
+		const bool IsUbergraph = &Function == GeneratedClass->UberGraphFunction;
+		if (IsUbergraph && Settings.IncludeEventGraphsInBytecodeBudgets == false && LogCosts == false)
+		{
+			continue;
+		}
+
+		const UObject* FunctionObject = &Blueprint;
+		if (IsUbergraph && Blueprint.UbergraphPages.Num() > 0)
+		{
+			FunctionObject = Blueprint.UbergraphPages[0];
+		}
+		else if (auto* FunctionGraph = Blueprint.FunctionGraphs.FindByPredicate(
+					 [&](const UEdGraph* Graph) { return Graph && Graph->GetFName() == Function.GetFName(); }))
+		{
+			FunctionObject = *FunctionGraph;
+		}
+
+		const FBytecodeCost Cost = EstimateBytecodeCost(Function);
+
+		bool AnyBudgetExceeded = false;
+		auto ConditionallyAddDiagnostic = [&](EDiagnosticRule Rule, int32 Value, int32 Budget) {
+			if (Value <= Budget || (IsUbergraph && Settings.IncludeEventGraphsInBytecodeBudgets == false))
+			{
+				return;
+			}
+			AnyBudgetExceeded = true;
+			DiagnosticFunction(FDiagnostic{Rule, FailureSeverity, FunctionObject, {Value, Budget}});
+		};
+		ConditionallyAddDiagnostic(
+			EDiagnosticRule::BytecodeInstructions,
+			Cost.Instructions,
+			Settings.MaxBytecodeInstructionsPerFunction);
+		ConditionallyAddDiagnostic(
+			EDiagnosticRule::BytecodeContextSwitches,
+			Cost.ContextSwitches,
+			Settings.MaxBytecodeContextSwitchesPerFunction);
+		ConditionallyAddDiagnostic(
+			EDiagnosticRule::BytecodeFunctionCalls,
+			Cost.FunctionCalls,
+			Settings.MaxBytecodeFunctionCallsPerFunction);
+		ConditionallyAddDiagnostic(
+			EDiagnosticRule::BytecodeContainerCopies,
+			Cost.ContainerCopies,
+			Settings.MaxContainerCopiesPerFunction);
+
+		if (LogCosts || AnyBudgetExceeded)
+		{
+			DiagnosticFunction(FDiagnostic{
+				EDiagnosticRule::BytecodeCost,
+				EMessageSeverity::Info,
+				FunctionObject,
+				{Cost.Instructions,
+				 Cost.ContextSwitches,
+				 Cost.FunctionCalls,
+				 Cost.ContainerCopies,
+				 Cost.ScriptSize,
+				 Cost.IsComplete ? 1 : 0}});
+		}
+	}
+}
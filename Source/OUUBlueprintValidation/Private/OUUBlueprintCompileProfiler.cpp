@@ -0,0 +1,316 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintCompileProfiler.h"
+
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "KismetCompiler.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "OUUBlueprintValidationSettings.h"
+
+namespace OUU::BlueprintValidation
+{
+	static TUniquePtr<FBlueprintCompileProfiler> GBlueprintCompileProfiler;
+
+	// DurationMs of rows with IncludesBatchStages = 1 also contains the stages that are shared by the whole batch
+	static const TCHAR* CompileProfileHeader =
+		TEXT("Timestamp,Blueprint,DurationMs,BytecodeBytes,NodeCount,BatchSize,IncludesBatchStages");
+
+	void FBlueprintCompileProfiler::Startup()
+	{
+		GBlueprintCompileProfiler = TUniquePtr<FBlueprintCompileProfiler>(new FBlueprintCompileProfiler());
+	}
+
+	void FBlueprintCompileProfiler::Shutdown() { GBlueprintCompileProfiler.Reset(); }
+
+	FBlueprintCompileProfiler& FBlueprintCompileProfiler::Get()
+	{
+		check(IsInGameThread());
+		return *GBlueprintCompileProfiler;
+	}
+
+	FBlueprintCompileProfiler::FBlueprintCompileProfiler()
+	{
+		// Editor modules are loaded before the editor engine is created
+		if (GEditor)
+		{
+			BindEditorDelegates();
+		}
+		else
+		{
+			PostEngineInitHandle =
+				FCoreDelegates::OnPostEngineInit.AddRaw(this, &FBlueprintCompileProfiler::BindEditorDelegates);
+		}
+	}
+
+	FBlueprintCompileProfiler::~FBlueprintCompileProfiler()
+	{
+		FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+		if (GEditor)
+		{
+			GEditor->OnBlueprintPreCompile().RemoveAll(this);
+			GEditor->OnBlueprintCompiled().RemoveAll(this);
+		}
+		// Flushing reads the log size limit from the settings
+		if (UObjectInitialized())
+		{
+			Flush();
+		}
+	}
+
+	void FBlueprintCompileProfiler::RecordCompiledBlueprint(const FKismetCompilerContext& CompilationContext)
+	{
+		auto* Blueprint = CompilationContext.Blueprint;
+		double StartTime = 0.0;
+		if (Blueprint == nullptr || CompileStartTimes.RemoveAndCopyValue(Blueprint, OUT StartTime) == false)
+		{
+			// Profiling was disabled when the compilation started
+			return;
+		}
+		// Earlier blueprints of the same batch are compiled after this blueprint's pre-compile event
+		const double CurrentTime = FPlatformTime::Seconds();
+		const bool IsFirstOfBatch = BatchTimerStart == 0.0;
+		const double DurationMs = (CurrentTime - FMath::Max(StartTime, BatchTimerStart)) * 1000.0;
+		BatchTimerStart = CurrentTime;
+
+		int32 BytecodeSize = 0;
+		if (auto* GeneratedClass = CompilationContext.NewClass)
+		{
+			for (TFieldIterator<UFunction> It(GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+			{
+				BytecodeSize += It->Script.Num();
+			}
+		}
+
+		int32 NodeCount = 0;
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(OUT Graphs);
+		for (const auto* Graph : Graphs)
+		{
+			NodeCount += Graph ? Graph->Nodes.Num() : 0;
+		}
+
+		PendingLines.Add(FString::Printf(
+			TEXT("%s,%s,%.3f,%i,%i,%i,%i"),
+			*FDateTime::UtcNow().ToIso8601(),
+			*Blueprint->GetPathName(),
+			DurationMs,
+			BytecodeSize,
+			NodeCount,
+			// Blueprints that are still being compiled + this one
+			CompileStartTimes.Num() + 1,
+			IsFirstOfBatch ? 1 : 0));
+	}
+
+	void FBlueprintCompileProfiler::RestartBatchTimer()
+	{
+		if (CompileStartTimes.Num() > 0)
+		{
+			BatchTimerStart = FPlatformTime::Seconds();
+		}
+	}
+
+	void FBlueprintCompileProfiler::Flush()
+	{
+		if (PendingLines.IsEmpty())
+		{
+			return;
+		}
+
+		const FString LogFilePath = GetLogFilePath();
+		auto& FileManager = IFileManager::Get();
+		const int64 MaxLogFileSize =
+			static_cast<int64>(UOUUBlueprintValidationSettings::Get().MaxCompileProfileLogSizeKB) * 1024;
+		if (FileManager.FileSize(*LogFilePath) > MaxLogFileSize)
+		{
+			FileManager.Move(*GetPreviousLogFilePath(), *LogFilePath);
+		}
+
+		FString Text;
+		if (FileManager.FileExists(*LogFilePath) == false)
+		{
+			Text.Append(CompileProfileHeader).AppendChar(TEXT('\n'));
+		}
+		for (const auto& Line : PendingLines)
+		{
+			Text.Append(Line).AppendChar(TEXT('\n'));
+		}
+		PendingLines.Reset();
+
+		FFileHelper::SaveStringToFile(
+			Text,
+			*LogFilePath,
+			FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+			&FileManager,
+			FILEWRITE_Append);
+	}
+
+	FString FBlueprintCompileProfiler::GetLogFilePath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("OUUBlueprintValidation") / TEXT("CompileProfile.csv");
+	}
+
+	FString FBlueprintCompileProfiler::GetPreviousLogFilePath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("OUUBlueprintValidation") / TEXT("CompileProfile-Previous.csv");
+	}
+
+	void FBlueprintCompileProfiler::BindEditorDelegates()
+	{
+		FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+		if (GEditor)
+		{
+			GEditor->OnBlueprintPreCompile().AddRaw(this, &FBlueprintCompileProfiler::HandleBlueprintPreCompile);
+			GEditor->OnBlueprintCompiled().AddRaw(this, &FBlueprintCompileProfiler::HandleBlueprintCompiled);
+		}
+	}
+
+	void FBlueprintCompileProfiler::HandleBlueprintPreCompile(UBlueprint* Blueprint)
+	{
+		// Cooking is not an iteration time cost
+		if (Blueprint && UOUUBlueprintValidationSettings::Get().ProfileBlueprintCompilation
+			&& IsRunningCookCommandlet() == false)
+		{
+			CompileStartTimes.Add(Blueprint, FPlatformTime::Seconds());
+		}
+	}
+
+	void FBlueprintCompileProfiler::HandleBlueprintCompiled()
+	{
+		// All blueprints of the batch are compiled. Blueprints that did not notify the compiler extension (e.g. data
+		// only blueprints or failed compilations) are not recorded.
+		CompileStartTimes.Reset();
+		BatchTimerStart = 0.0;
+		Flush();
+	}
+
+	struct FCompileProfileSample
+	{
+		double DurationMs = 0.0;
+		int32 BytecodeSize = 0;
+		int32 NodeCount = 0;
+	};
+
+	static void ReadCompileProfileLog(
+		const FString& FilePath,
+		TMap<FString, TArray<FCompileProfileSample>>& InOutSamples)
+	{
+		TArray<FString> Lines;
+		if (FFileHelper::LoadFileToStringArray(OUT Lines, *FilePath) == false)
+		{
+			return;
+		}
+
+		TArray<FString> Columns;
+		for (const auto& Line : Lines)
+		{
+			Line.ParseIntoArray(OUT Columns, TEXT(","), false);
+			if (Columns.Num() < 5 || Line.StartsWith(TEXT("Timestamp,")))
+			{
+				continue;
+			}
+			InOutSamples.FindOrAdd(Columns[1]).Add(
+				{FCString::Atod(*Columns[2]), FCString::Atoi(*Columns[3]), FCString::Atoi(*Columns[4])});
+		}
+	}
+
+	static void PrintCompileProfileReport(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		if (GBlueprintCompileProfiler.IsValid())
+		{
+			GBlueprintCompileProfiler->Flush();
+		}
+
+		const int32 MaxCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+
+		// Samples of each blueprint from oldest to newest
+		TMap<FString, TArray<FCompileProfileSample>> Samples;
+		ReadCompileProfileLog(FBlueprintCompileProfiler::GetPreviousLogFilePath(), IN OUT Samples);
+		ReadCompileProfileLog(FBlueprintCompileProfiler::GetLogFilePath(), IN OUT Samples);
+
+		struct FReportEntry
+		{
+			const FString* Blueprint = nullptr;
+			const TArray<FCompileProfileSample>* Samples = nullptr;
+			double AverageMs = 0.0;
+			double MaxMs = 0.0;
+			// Change of the average duration of the newer half of the samples compared to the older half
+			TOptional<double> TrendPercent;
+		};
+
+		auto GetAverageMs = [](TConstArrayView<FCompileProfileSample> InSamples) {
+			double SumMs = 0.0;
+			for (const auto& Sample : InSamples)
+			{
+				SumMs += Sample.DurationMs;
+			}
+			return InSamples.Num() > 0 ? SumMs / InSamples.Num() : 0.0;
+		};
+
+		TArray<FReportEntry> Entries;
+		Entries.Reserve(Samples.Num());
+		for (const auto& BlueprintSamples : Samples)
+		{
+			auto& Entry = Entries.AddDefaulted_GetRef();
+			Entry.Blueprint = &BlueprintSamples.Key;
+			Entry.Samples = &BlueprintSamples.Value;
+			Entry.AverageMs = GetAverageMs(BlueprintSamples.Value);
+			for (const auto& Sample : BlueprintSamples.Value)
+			{
+				Entry.MaxMs = FMath::Max(Entry.MaxMs, Sample.DurationMs);
+			}
+
+			const TConstArrayView<FCompileProfileSample> AllSamples = BlueprintSamples.Value;
+			const int32 NumOlderSamples = AllSamples.Num() / 2;
+			const double OlderAverageMs = GetAverageMs(AllSamples.Left(NumOlderSamples));
+			if (NumOlderSamples > 0 && OlderAverageMs > 0.0)
+			{
+				const double NewerAverageMs = GetAverageMs(AllSamples.RightChop(NumOlderSamples));
+				Entry.TrendPercent = (NewerAverageMs / OlderAverageMs - 1.0) * 100.0;
+			}
+		}
+		Entries.Sort([](const FReportEntry& A, const FReportEntry& B) { return A.AverageMs > B.AverageMs; });
+
+		Ar.Logf(
+			TEXT("Slowest %i of %i compiled blueprints (%s):"),
+			FMath::Min(MaxCount, Entries.Num()),
+			Entries.Num(),
+			*FBlueprintCompileProfiler::GetLogFilePath());
+		Ar.Logf(
+			TEXT("%10s %10s %10s %6s %8s %10s %7s  %s"),
+			TEXT("Avg ms"),
+			TEXT("Max ms"),
+			TEXT("Last ms"),
+			TEXT("Count"),
+			TEXT("Trend"),
+			TEXT("Bytecode"),
+			TEXT("Nodes"),
+			TEXT("Blueprint"));
+		for (int32 Idx = 0; Idx < FMath::Min(MaxCount, Entries.Num()); ++Idx)
+		{
+			const auto& Entry = Entries[Idx];
+			const auto& LastSample = Entry.Samples->Last();
+			Ar.Logf(
+				TEXT("%10.2f %10.2f %10.2f %6i %8s %10i %7i  %s"),
+				Entry.AverageMs,
+				Entry.MaxMs,
+				LastSample.DurationMs,
+				Entry.Samples->Num(),
+				Entry.TrendPercent.IsSet() ? *FString::Printf(TEXT("%+.0f%%"), Entry.TrendPercent.GetValue())
+										   : TEXT("-"),
+				LastSample.BytecodeSize,
+				LastSample.NodeCount,
+				**Entry.Blueprint);
+		}
+	}
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice CompileProfileReportCommand(
+		TEXT("OUUBlueprintValidation.CompileProfileReport"),
+		TEXT("List the blueprints with the highest average compile time from the compile profile log, including the "
+			 "trend of their compile time. Optional argument: number of blueprints to list (default 20)."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&PrintCompileProfileReport));
+} // namespace OUU::BlueprintValidation
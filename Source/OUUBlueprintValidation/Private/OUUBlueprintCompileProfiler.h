@@ -0,0 +1,62 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/ObjectKey.h"
+
+class FKismetCompilerContext;
+class UBlueprint;
+
+namespace OUU::BlueprintValidation
+{
+	// Records compile duration, bytecode size and node count of every compiled blueprint to a rolling CSV log in the
+	// saved directory, so compile times can be compared across sessions and users
+	// (console command OUUBlueprintValidation.CompileProfileReport).
+	// The pre-compile event is broadcast for all blueprints of a batch before any of them is compiled, and the compiler
+	// extension is notified for one blueprint after the other. So the duration of a blueprint is measured from the end
+	// of the previous blueprint of the same batch (or its pre-compile event for the first one) until the compiler
+	// extension is notified. Stages that are shared by the whole batch (e.g. skeleton class generation) are only
+	// included in the duration of the first blueprint of a batch, which is marked in the IncludesBatchStages column.
+	// The number of blueprints that were compiled at the same time is logged as batch size.
+	// Must only be used from the game thread.
+	class FBlueprintCompileProfiler
+	{
+	public:
+		// Called by the module
+		static void Startup();
+		static void Shutdown();
+
+		static FBlueprintCompileProfiler& Get();
+
+		~FBlueprintCompileProfiler();
+
+		// Called by the compiler extension after the bytecode of a blueprint was generated
+		void RecordCompiledBlueprint(const FKismetCompilerContext& CompilationContext);
+
+		// Called by the compiler extension after validating a blueprint, so the validation is not included in the
+		// duration of the next blueprint of the batch
+		void RestartBatchTimer();
+
+		// Write all pending records to the log file
+		void Flush();
+
+		static FString GetLogFilePath();
+		// Previous log file that is kept when the log file is rolled over
+		static FString GetPreviousLogFilePath();
+
+	private:
+		FBlueprintCompileProfiler();
+
+		void BindEditorDelegates();
+		void HandleBlueprintPreCompile(UBlueprint* Blueprint);
+		void HandleBlueprintCompiled();
+
+		TMap<TObjectKey<UBlueprint>, double> CompileStartTimes;
+		// End of the previous blueprint of the current batch. 0 if no blueprint of the batch was recorded yet.
+		double BatchTimerStart = 0.0;
+		TArray<FString> PendingLines;
+		FDelegateHandle PostEngineInitHandle;
+	};
+} // namespace OUU::BlueprintValidation
@@ -3,232 +3,419 @@
 #include "OUUBlueprintComplexity.h"
 
 #include "EdGraph/EdGraph.h"
-#include "EdGraphNode_Comment.h"
-#include "EdGraphSchema_K2.h"
-#include "K2Node_ExecutionSequence.h"
+#include "OUUBlueprintGraphSnapshot.h"
+#include "OUUBlueprintValidationStats.h"
 #include "OUUBlueprintValidationUtils.h"
 
 namespace OUU::BlueprintValidation
 {
-	int32 CountBranches(UEdGraphNode& Node, TSet<uint32>& VisitedNodes)
+	struct FExecFlowCounts
 	{
-		if (VisitedNodes.Contains(Node.GetUniqueID()))
-		{
-			return 0;
-		}
-		VisitedNodes.Add(Node.GetUniqueID());
-
-		// We only have to consider outgoing exec connections.
-		// Theoretically blueprint Pure inputs also contribute to executions, but they are always executed on all
-		// branches, so there's only a matter of value selection, not execution flow / order changes on the BP graph
-		// level.
-		TArray<UEdGraphPin*> ConnectedExecOutPins = Node.Pins.FilterByPredicate([](const UEdGraphPin* Pin) {
-			return Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec && Pin->Direction == EGPD_Output;
-		});
+		// Additional execution paths on top of the entry points according to our lenient (Galea) counting
+		int32 Branches = 0;
+		// Nodes and edges of the exec control flow graph for the McCabe formula
+		int32 Nodes = 0;
+		int32 Edges = 0;
+	};
 
-		TArray<UEdGraphPin*> ConnectedPins;
-		TArray<UEdGraphNode*> ConnectedNodes;
-		bool HasDisconnectedOutputs = false;
-		bool HasConnectedOutputs = false;
-		for (const auto ExecOutPin : ConnectedExecOutPins)
+	// Traverse the exec flow reachable from a single entry node.
+	// Uses an explicit worklist instead of recursion, so even very long exec chains can't overflow the stack, and does
+	// not allocate per node (the worklist is owned by the caller and reused for all entry nodes).
+	static void TraverseExecFlow(
+		const FGraphSnapshot& Snapshot,
+		int32 EntryNodeIdx,
+		TBitArray<>& VisitedNodes,
+		TArray<int32>& Worklist,
+		FExecFlowCounts& InOutCounts)
+	{
+		Worklist.Reset();
+		Worklist.Add(EntryNodeIdx);
+		while (Worklist.Num() > 0)
 		{
-			if (ExecOutPin->LinkedTo.IsEmpty())
+			const int32 NodeIdx = Worklist.Pop(EAllowShrinking::No);
+			if (VisitedNodes[NodeIdx])
 			{
-				HasDisconnectedOutputs = true;
+				continue;
 			}
-			else
+			VisitedNodes[NodeIdx] = true;
+			InOutCounts.Nodes++;
+
+			// We only have to consider outgoing exec connections.
+			// Theoretically blueprint Pure inputs also contribute to executions, but they are always executed on all
+			// branches, so there's only a matter of value selection, not execution flow / order changes on the BP
+			// graph level.
+			const auto ExecOutTargetNodes = Snapshot.GetExecOutTargetNodes(NodeIdx);
+			const auto ExecOutTargetPins = Snapshot.GetExecOutTargetPins(NodeIdx);
+
+			TArray<uint64, TInlineAllocator<16>> ExecOutTargets;
+			for (int32 ExecOutIdx = 0; ExecOutIdx < ExecOutTargetPins.Num(); ++ExecOutIdx)
 			{
-				// exec OUT pins are always just connected to a single other pin and node
-				HasConnectedOutputs = true;
-				ConnectedPins.AddUnique(ExecOutPin->LinkedTo[0]);
-				ConnectedNodes.AddUnique(ExecOutPin->LinkedTo[0]->GetOwningNode());
+				const int32 TargetPin = ExecOutTargetPins[ExecOutIdx];
+				const int32 TargetNode = ExecOutTargetNodes[ExecOutIdx];
+				const uint64 TargetId =
+					(static_cast<uint64>(static_cast<uint32>(TargetNode)) << 32) | static_cast<uint32>(TargetPin);
+				ExecOutTargets.Add(TargetPin == INDEX_NONE ? DisconnectedExecOutput : TargetId);
+
+				if (TargetNode != INDEX_NONE && VisitedNodes[TargetNode] == false)
+				{
+					Worklist.Add(TargetNode);
+				}
 			}
+
+			const auto NodeCounts =
+				CountExecOutputs(ExecOutTargets, Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::ExecutionSequence));
+			InOutCounts.Branches += NodeCounts.Branches;
+			InOutCounts.Edges += NodeCounts.Edges;
 		}
+	}
 
-		if (HasConnectedOutputs == false)
+	FExecOutputCounts CountExecOutputs(TConstArrayView<uint64> ExecOutTargets, bool IsExecutionSequence)
+	{
+		FExecOutputCounts Counts;
+		if (ExecOutTargets.Num() == 0)
 		{
-			return 0;
+			// Nodes without any exec outputs (e.g. return nodes) are connected to the implicit exit node.
+			Counts.Edges = 1;
+			return Counts;
 		}
 
-		uint32 BranchCounter = 0;
+		// Every exec output is an edge of the control flow graph.
+		// Disconnected outputs are edges to the implicit exit node.
+		Counts.Edges = ExecOutTargets.Num();
 
-		// The sequence node is the only node I could think of that can be connected to arbitrarily many other nodes or
-		// have disconnected output pins without creating new possible execution paths / early returns.
-		if (Node.IsA<UK2Node_ExecutionSequence>() == false)
+		bool HasDisconnectedOutputs = false;
+		int32 NumConnectedPins = 0;
+		for (int32 ExecOutIdx = 0; ExecOutIdx < ExecOutTargets.Num(); ++ExecOutIdx)
 		{
-			if (HasDisconnectedOutputs)
+			const uint64 Target = ExecOutTargets[ExecOutIdx];
+			if (Target == DisconnectedExecOutput)
 			{
-				// If we know there's both disconnected and connected output pins those are early returns or
-				// continuations, i.e. 1 additional branch.
-				BranchCounter++;
+				HasDisconnectedOutputs = true;
+				continue;
 			}
 
-			// Number of alternative exec pins on this same node.
-			// We consider every secondary output pin on a node a "branch" except for those on sequence nodes.
-			// Since nodes that have multiple inputs are usually flow control nodes like gates, async tasks, etc.
-			// those pins need to be counted individually, not just per node.
-			BranchCounter += FMath::Max(0, ConnectedPins.Num() - 1);
+			// Multiple exec outputs connected to the same input pin are not alternative paths.
+			// Nodes have very few exec outputs, so a linear search is cheaper than any set.
+			if (MakeArrayView(ExecOutTargets.GetData(), ExecOutIdx).Contains(Target) == false)
+			{
+				NumConnectedPins++;
+			}
 		}
 
-		for (const auto& ConnectedNode : ConnectedNodes)
+		// The sequence node is the only node I could think of that can be connected to arbitrarily many other nodes
+		// or have disconnected output pins without creating new possible execution paths / early returns.
+		if (NumConnectedPins == 0 || IsExecutionSequence)
 		{
-			if (IsValid(ConnectedNode))
-			{
-				BranchCounter += CountBranches(*ConnectedNode, VisitedNodes);
-			}
+			return Counts;
+		}
+
+		if (HasDisconnectedOutputs)
+		{
+			// If we know there's both disconnected and connected output pins those are early returns or
+			// continuations, i.e. 1 additional branch.
+			Counts.Branches++;
 		}
 
-		return BranchCounter;
+		// Number of alternative exec pins on this same node.
+		// We consider every secondary output pin on a node a "branch" except for those on sequence nodes.
+		// Since nodes that have multiple inputs are usually flow control nodes like gates, async tasks, etc.
+		// those pins need to be counted individually, not just per node.
+		Counts.Branches += NumConnectedPins - 1;
+		return Counts;
 	}
 
-	double ComputeCyclomaticGraphComplexity(UEdGraph& Graph)
+	FHalsteadComplexity ComputeHalsteadComplexity(
+		uint32 NumberOfUniqueOperators,
+		uint32 NumberOfUniqueOperands,
+		uint32 NumberOfTotalOperators,
+		uint32 NumberOfTotalOperands)
 	{
-		if (!ensure(OUU::BlueprintValidation::IsBlueprintGraph(Graph)))
+		FHalsteadComplexity Halstead;
+		Halstead.Vocabulary = NumberOfUniqueOperators + NumberOfUniqueOperands;
+		Halstead.Length = NumberOfTotalOperators + NumberOfTotalOperands;
+		Halstead.Volume = Halstead.Vocabulary == 0
+			? 0
+			: static_cast<double>(Halstead.Length) * FMath::Log2(static_cast<double>(Halstead.Vocabulary));
+		Halstead.Difficulty = NumberOfUniqueOperands == 0 ? 0
+														  : (static_cast<double>(NumberOfUniqueOperators) / 2.0)
+				* (static_cast<double>(NumberOfTotalOperators) / static_cast<double>(NumberOfUniqueOperands));
+		Halstead.Effort = Halstead.Difficulty * Halstead.Volume;
+		return Halstead;
+	}
+
+	FPureExpressionInfo AnalyzePureExpressions(
+		const FGraphSnapshot& Snapshot,
+		TConstArrayView<uint32> ParamPinEvaluationCounts)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_AnalyzePureExpressions);
+		const int32 NumNodes = Snapshot.NumNodes();
+		check(
+			ParamPinEvaluationCounts.Num() == 0
+			|| ParamPinEvaluationCounts.Num() == Snapshot.NumParamPins());
+
+		// Invert the parameter links, so we get the distinct consumer nodes of every pure node (CSR layout)
+		TArray<int32> ConsumerOffsets;
+		ConsumerOffsets.SetNumZeroed(NumNodes + 1);
+		TArray<int32> Consumers;
+		// How often an impure consumer evaluates the pure node. Max of all pins linked to the same pure node.
+		TArray<uint32> ConsumerEvaluationCounts;
+		TArray<int32> LastConsumers;
+		auto ForEachConsumerLink = [&](auto&& Callback) {
+			LastConsumers.Init(INDEX_NONE, NumNodes);
+			for (int32 ConsumerIdx = 0; ConsumerIdx < NumNodes; ++ConsumerIdx)
+			{
+				const int32 FirstParamPin = Snapshot.GetFirstParamPin(ConsumerIdx);
+				const int32 LastParamPin = FirstParamPin + Snapshot.GetNumParamPins(ConsumerIdx);
+				for (int32 ParamPinIdx = FirstParamPin; ParamPinIdx < LastParamPin; ++ParamPinIdx)
+				{
+					for (const int32 SourceNodeIdx : Snapshot.GetParamPinSourceNodes(ParamPinIdx))
+					{
+						if (SourceNodeIdx == INDEX_NONE || SourceNodeIdx == ConsumerIdx
+							|| Snapshot.IsPureK2Node(SourceNodeIdx) == false)
+						{
+							continue;
+						}
+						const bool IsNewConsumer = LastConsumers[SourceNodeIdx] != ConsumerIdx;
+						LastConsumers[SourceNodeIdx] = ConsumerIdx;
+						Callback(SourceNodeIdx, ConsumerIdx, ParamPinIdx, IsNewConsumer);
+					}
+				}
+			}
+		};
+		ForEachConsumerLink([&](int32 SourceNodeIdx, int32 ConsumerIdx, int32 ParamPinIdx, bool IsNewConsumer) {
+			if (IsNewConsumer)
+			{
+				ConsumerOffsets[SourceNodeIdx + 1]++;
+			}
+		});
+		for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
 		{
-			return 0.0;
+			ConsumerOffsets[NodeIdx + 1] += ConsumerOffsets[NodeIdx];
 		}
-		TSet<uint32> VisitedNodes;
-		int32 GraphComplexity = 0;
-		VisitedNodes.Empty();
-		for (auto& Node : Graph.Nodes)
+		Consumers.SetNumUninitialized(ConsumerOffsets[NumNodes]);
+		ConsumerEvaluationCounts.SetNumUninitialized(ConsumerOffsets[NumNodes]);
+		TArray<int32> InsertPositions(ConsumerOffsets.GetData(), NumNodes);
+		ForEachConsumerLink([&](int32 SourceNodeIdx, int32 ConsumerIdx, int32 ParamPinIdx, bool IsNewConsumer) {
+			const uint32 PinEvaluationCount =
+				ParamPinEvaluationCounts.Num() > 0 ? ParamPinEvaluationCounts[ParamPinIdx] : 1;
+			if (IsNewConsumer)
+			{
+				ConsumerEvaluationCounts[InsertPositions[SourceNodeIdx]] = PinEvaluationCount;
+				Consumers[InsertPositions[SourceNodeIdx]++] = ConsumerIdx;
+			}
+			else
+			{
+				// Links of the same consumer are always inserted consecutively
+				auto& ConsumerEvaluationCount = ConsumerEvaluationCounts[InsertPositions[SourceNodeIdx] - 1];
+				ConsumerEvaluationCount = FMath::Max(ConsumerEvaluationCount, PinEvaluationCount);
+			}
+		});
+
+		// Evaluate all consumers before the nodes they consume (post-order DFS along consumer links).
+		// Pure nodes are always supposed to form a DAG, but broken graphs may contain cycles, which are cut by ignoring
+		// links to nodes that are still in progress.
+		FPureExpressionInfo Result;
+		Result.EvaluationCounts.SetNumZeroed(NumNodes);
+		TBitArray<> StartedNodes(false, NumNodes);
+		struct FStackEntry
 		{
-			if (IsValid(Node) && IsBlueprintEntryNode(*Node))
+			int32 NodeIdx;
+			int32 NextConsumer;
+		};
+		TArray<FStackEntry> Stack;
+		for (int32 RootNodeIdx = 0; RootNodeIdx < NumNodes; ++RootNodeIdx)
+		{
+			if (Snapshot.IsPureK2Node(RootNodeIdx) == false || StartedNodes[RootNodeIdx])
+			{
+				continue;
+			}
+
+			StartedNodes[RootNodeIdx] = true;
+			Stack.Add({RootNodeIdx, ConsumerOffsets[RootNodeIdx]});
+			while (Stack.Num() > 0)
 			{
-				// Always start with 1 for each entry point of the graph
-				int32 NumberOfBranches = 1 + CountBranches(*Node, IN OUT VisitedNodes);
-				GraphComplexity += NumberOfBranches;
+				auto& Entry = Stack.Last();
+				const int32 NodeIdx = Entry.NodeIdx;
+				if (Entry.NextConsumer < ConsumerOffsets[NodeIdx + 1])
+				{
+					const int32 ConsumerIdx = Consumers[Entry.NextConsumer++];
+					if (Snapshot.IsPureK2Node(ConsumerIdx) && StartedNodes[ConsumerIdx] == false)
+					{
+						StartedNodes[ConsumerIdx] = true;
+						Stack.Add({ConsumerIdx, ConsumerOffsets[ConsumerIdx]});
+					}
+					continue;
+				}
+
+				uint64 EvaluationCount = 0;
+				for (int32 ConsumerLinkIdx = ConsumerOffsets[NodeIdx]; ConsumerLinkIdx < ConsumerOffsets[NodeIdx + 1];
+					 ++ConsumerLinkIdx)
+				{
+					const int32 ConsumerIdx = Consumers[ConsumerLinkIdx];
+					if (Snapshot.IsPureK2Node(ConsumerIdx))
+					{
+						EvaluationCount += Result.EvaluationCounts[ConsumerIdx];
+					}
+					else if (Snapshot.HasAnyFlags(ConsumerIdx, EGraphNodeFlags::K2Node))
+					{
+						// Impure nodes evaluate all of their pure inputs once per execution
+						EvaluationCount += ConsumerEvaluationCounts[ConsumerLinkIdx];
+					}
+				}
+				Result.EvaluationCounts[NodeIdx] = static_cast<uint32>(FMath::Min<uint64>(EvaluationCount, MAX_uint32));
+				Stack.Pop(EAllowShrinking::No);
 			}
 		}
-		return GraphComplexity;
+
+		return Result;
+	}
+
+	double ComputeCyclomaticGraphComplexity(UEdGraph& Graph)
+	{
+		return ComputeGraphMetrics(Graph).CyclomaticComplexity;
 	}
 
 	FHalsteadComplexity ComputeHalsteadGraphComplexity(UEdGraph& Graph)
+	{
+		return ComputeGraphMetrics(Graph).Halstead;
+	}
+
+	double CountBlueprintLinesOfCode(UEdGraph& Graph) { return ComputeGraphMetrics(Graph).LinesOfCode; }
+
+	uint32 CountGraphComments(UEdGraph& Graph) { return ComputeGraphMetrics(Graph).CommentCount; }
+
+	FGraphMetrics ComputeGraphMetrics(UEdGraph& Graph)
 	{
 		if (!ensure(OUU::BlueprintValidation::IsBlueprintGraph(Graph)))
 		{
 			return {};
 		}
 
-		uint32 NumberOfTotalOperators = 0, NumberOfTotalOperands = 0;
+		return ComputeGraphMetrics(BuildGraphSnapshot(Graph));
+	}
+
+	FGraphMetrics ComputeGraphMetrics(const FGraphSnapshot& Snapshot)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ComputeGraphMetrics);
+		FGraphMetrics Result;
+		const int32 NumNodes = Snapshot.NumNodes();
+		Result.NodeCount = NumNodes;
 
-		TSet<uint32> VisitedNodes;
+		// Lines of code
+		uint32 NumberOfPureNodes = 0, NumberOfImpureNodes = 0;
+
+		// Cyclomatic complexity
+		int32 NumEntryNodes = 0, NumExecFlowComponents = 0;
+		FExecFlowCounts ExecFlowCounts;
+		TBitArray<> CyclomaticVisitedNodes(false, NumNodes);
+		TArray<int32> ExecFlowWorklist;
 
-		TSet<FString> UniqueParameterValues;
-		TSet<uint32> UniqueOperatorNodes;
+		// Halstead complexity
+		uint32 NumberOfTotalOperators = 0, NumberOfTotalOperands = 0;
+		uint32 NumberOfUniqueOperatorNodes = 0;
 		// Nodes that are not functions but variables / property access / etc that have no parameter pins
-		TSet<uint32> UniqueOperandNodes;
+		uint32 NumberOfUniqueOperandNodes = 0;
+		TBitArray<> HalsteadVisitedNodes(false, NumNodes);
+		// Every literal pin is processed once and is a distinct operand, so the number of unique literal operands
+		// equals the number of literal pins.
+		uint32 NumberOfLiteralOperands = 0;
+		// Nodes whose parameter pins still have to be processed. Reused for all impure nodes.
+		TArray<int32> PendingParameterNodes;
 
-		for (auto& Node : Graph.Nodes)
+		for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
 		{
-			auto* K2Node = Cast<UK2Node>(Node);
-			if (K2Node == nullptr || K2Node->IsNodePure() || VisitedNodes.Contains(K2Node->GetUniqueID()))
+			if (Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::Comment))
 			{
-				continue;
+				Result.CommentCount++;
 			}
-			VisitedNodes.Add(K2Node->GetUniqueID());
-			UniqueOperatorNodes.Add(K2Node->GetUniqueID());
 
-			TArray<UEdGraphPin*> ParameterPins = GetInputParameterPins(*Node);
-			for (auto ParamPinIt = ParameterPins.CreateIterator(); ParamPinIt; ++ParamPinIt)
+			if (Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::Entry))
 			{
-				auto* ParamPin = *ParamPinIt;
-				if (ParamPin->LinkedTo.IsEmpty())
+				NumEntryNodes++;
+				if (CyclomaticVisitedNodes[NodeIdx] == false)
 				{
-					// we consider values in their clipboard/copy format
-					FString PinValue;
-					ParamPin->ExportTextItem(OUT PinValue, PPF_Copy);
-					UniqueParameterValues.Add(PinValue);
-					NumberOfTotalOperands++;
+					NumExecFlowComponents++;
 				}
-				else
+				TraverseExecFlow(
+					Snapshot,
+					NodeIdx,
+					IN OUT CyclomaticVisitedNodes,
+					IN OUT ExecFlowWorklist,
+					IN OUT ExecFlowCounts);
+			}
+
+			if (Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::K2Node) == false)
+			{
+				continue;
+			}
+
+			if (Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::Pure))
+			{
+				// Pure nodes only contribute to the halstead complexity if they are connected to an impure node,
+				// which is handled when processing the parameter pins of that impure node below.
+				NumberOfPureNodes++;
+				continue;
+			}
+
+			NumberOfImpureNodes++;
+			NumberOfUniqueOperatorNodes++;
+
+			PendingParameterNodes.Reset();
+			PendingParameterNodes.Add(NodeIdx);
+			while (PendingParameterNodes.Num() > 0)
+			{
+				const int32 ParameterNodeIdx = PendingParameterNodes.Pop(EAllowShrinking::No);
+				const int32 FirstParamPin = Snapshot.GetFirstParamPin(ParameterNodeIdx);
+				const int32 LastParamPin = FirstParamPin + Snapshot.GetNumParamPins(ParameterNodeIdx);
+				for (int32 ParamPinIdx = FirstParamPin; ParamPinIdx < LastParamPin; ++ParamPinIdx)
 				{
-					for (auto* LinkedTo : ParamPin->LinkedTo)
+					if (Snapshot.IsParamPinLinked(ParamPinIdx) == false)
+					{
+						NumberOfLiteralOperands++;
+						NumberOfTotalOperands++;
+						continue;
+					}
+
+					for (const int32 SourceNodeIdx : Snapshot.GetParamPinSourceNodes(ParamPinIdx))
 					{
-						auto* LinkedToK2Node = Cast<UK2Node>(LinkedTo->GetOwningNode());
 						// ignore if the connection in itself is not a pure node (it will be processed at top level)
-						if (LinkedToK2Node == nullptr || LinkedToK2Node->IsNodePure() == false
-							|| VisitedNodes.Contains(LinkedToK2Node->GetUniqueID()))
+						if (SourceNodeIdx == INDEX_NONE || Snapshot.IsPureK2Node(SourceNodeIdx) == false
+							|| HalsteadVisitedNodes[SourceNodeIdx])
 						{
 							continue;
 						}
-						VisitedNodes.Add(LinkedToK2Node->GetUniqueID());
+						HalsteadVisitedNodes[SourceNodeIdx] = true;
 
-						auto RecursivePins = GetInputParameterPins(*LinkedToK2Node);
-						if (RecursivePins.IsEmpty())
+						NumberOfTotalOperators++;
+						if (Snapshot.GetNumParamPins(SourceNodeIdx) == 0)
 						{
-							NumberOfTotalOperators++;
-							UniqueOperandNodes.Add(LinkedToK2Node->GetUniqueID());
+							NumberOfUniqueOperandNodes++;
 						}
 						else
 						{
 							// This is an operator node
-							NumberOfTotalOperators++;
-							UniqueOperatorNodes.Add(LinkedToK2Node->GetUniqueID());
+							NumberOfUniqueOperatorNodes++;
+							PendingParameterNodes.Add(SourceNodeIdx);
 						}
-						ParameterPins.Append(RecursivePins);
 					}
 				}
 			}
 		}
 
-		uint32 NumberOfUniqueOperators = UniqueOperatorNodes.Num();
-		uint32 NumberOfUniqueOperands = UniqueOperandNodes.Num() + UniqueParameterValues.Num();
+		// Always start with 1 for each entry point of the graph
+		Result.CyclomaticComplexity = NumEntryNodes + ExecFlowCounts.Branches;
+		// E - N + 2P with P = number of entry points that were not reached from another entry point.
+		// Every component has its own implicit exit node, which is not included in the node count, so 2P becomes P.
+		Result.McCabeCyclomaticComplexity = ExecFlowCounts.Edges - ExecFlowCounts.Nodes + NumExecFlowComponents;
 
-		FHalsteadComplexity Result;
-		Result.Vocabulary = NumberOfUniqueOperators + NumberOfUniqueOperands;
-		Result.Length = NumberOfTotalOperators + NumberOfTotalOperands;
-		Result.Volume = Result.Vocabulary == 0
-			? 0
-			: static_cast<double>(Result.Length) * FMath::Log2(static_cast<double>(Result.Vocabulary));
-		Result.Difficulty = NumberOfUniqueOperands == 0 ? 0
-														: (static_cast<double>(NumberOfUniqueOperators) / 2.0)
-				* (static_cast<double>(NumberOfTotalOperators) / static_cast<double>(NumberOfUniqueOperands));
-		Result.Effort = Result.Difficulty * Result.Volume;
+		Result.Halstead = ComputeHalsteadComplexity(
+			NumberOfUniqueOperatorNodes,
+			NumberOfUniqueOperandNodes + NumberOfLiteralOperands,
+			NumberOfTotalOperators,
+			NumberOfTotalOperands);
 
-		return Result;
-	}
+		Result.LinesOfCode = NumberOfImpureNodes + (NumberOfPureNodes / MetricConstants::PureNodesPerLineOfCode);
 
-	double CountBlueprintLinesOfCode(UEdGraph& Graph)
-	{
-		if (!ensure(OUU::BlueprintValidation::IsBlueprintGraph(Graph)))
-		{
-			return 0.0;
-		}
-
-		uint32 NumberOfPureNodes = 0, NumberOfImpureNodes = 0;
-		for (auto& Node : Graph.Nodes)
-		{
-			if (auto* K2Node = Cast<UK2Node>(Node))
-			{
-				if (K2Node->IsNodePure())
-				{
-					NumberOfPureNodes++;
-				}
-				else
-				{
-					NumberOfImpureNodes++;
-				}
-			}
-		}
-
-		return NumberOfImpureNodes + (NumberOfPureNodes / 5.0);
-	}
-
-	uint32 CountGraphComments(UEdGraph& Graph)
-	{
-		if (!ensure(OUU::BlueprintValidation::IsBlueprintGraph(Graph)))
-		{
-			return 0;
-		}
-
-		uint32 NumComments = 0;
-		for (auto& Node : Graph.Nodes)
-		{
-			if (Node->IsA<UEdGraphNode_Comment>() || Node->NodeComment.Len() > 0)
-			{
-				NumComments++;
-			}
-		}
-		return NumComments;
+		return Result;
 	}
 } // namespace OUU::BlueprintValidation
@@ -0,0 +1,268 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintDiagnostics.h"
+
+#include "EdGraph/EdGraphNode.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/UObjectToken.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationUtils.h"
+
+namespace OUU::BlueprintValidation
+{
+	// The plugin location does not change at runtime, so it's only looked up once.
+	static const FString& GetPluginReadmeURL()
+	{
+		static const FString PluginReadmeURL = []() -> FString {
+			if (auto PluginPtr = IPluginManager::Get().FindPlugin(TEXT("OUUBlueprintValidation")))
+			{
+				return FString::Printf(
+					TEXT("file:///%s/README.md"),
+					*FPaths::ConvertRelativePathToFull(PluginPtr->GetBaseDir()));
+			}
+			return FString();
+		}();
+		return PluginReadmeURL;
+	}
+
+	static const FString& GetMaintainabilityHelpURL()
+	{
+		auto& Settings = UOUUBlueprintValidationSettings::Get();
+		return Settings.MaintainabilityDocumentationURL.IsEmpty() ? GetPluginReadmeURL()
+																	: Settings.MaintainabilityDocumentationURL;
+	}
+
+	FText FormatDiagnosticText(const FDiagnostic& Diagnostic)
+	{
+		const auto& Values = Diagnostic.Values;
+		switch (Diagnostic.Rule)
+		{
+		case EDiagnosticRule::GraphCount:
+			return FText::Format(
+				INVTEXT("Number of graphs: {0} (max per BP: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::MaintainabilityIndex:
+			return FText::Format(
+				INVTEXT("Maintainability index: {0} (min per graph: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Diagnostic.Limit));
+		case EDiagnosticRule::CyclomaticComplexity:
+			return FText::Format(
+				INVTEXT("Cyclomatic Complexity: {0} (max per graph: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::HalsteadVolume:
+			return FText::Format(
+				INVTEXT("Halstead volume: {0} (max per graph: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::NodeCount:
+			return FText::Format(
+				INVTEXT("Node count: {0} (max per graph: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::CommentPercentage:
+			return FText::Format(
+				INVTEXT("Comment percentage: {0} (min per graph: {1}; only if more than {2} nodes)"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Diagnostic.Limit),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::GraphMetrics:
+			return FText::Format(
+				INVTEXT("Maintainability Index: {0}; Cyclomatic Complexity: {1} (Galea: {5}, McCabe: {6}); "
+						"Halstead Volume: {2}; Node Count: {3}; Comment %: {4}"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]),
+				FText::AsNumber(Values[2]),
+				FText::AsNumber(Values[3]),
+				FText::AsNumber(Values[4]),
+				FText::AsNumber(Values[5]),
+				FText::AsNumber(Values[6]));
+		case EDiagnosticRule::BytecodeInstructions:
+			return FText::Format(
+				INVTEXT("Bytecode instructions: {0} (max per function: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::BytecodeContextSwitches:
+			return FText::Format(
+				INVTEXT("Bytecode context switches: {0} (max per function: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::BytecodeFunctionCalls:
+			return FText::Format(
+				INVTEXT("Bytecode function calls: {0} (max per function: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::BytecodeContainerCopies:
+			return FText::Format(
+				INVTEXT("Arrays, sets and maps copied by value: {0} (max per function: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::BytecodeCost:
+			return FText::Format(
+				INVTEXT("Bytecode Instructions: {0}; Context Switches: {1}; Function Calls: {2}; "
+						"Container Copies: {3}; Script Size: {4} bytes{5}"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]),
+				FText::AsNumber(Values[2]),
+				FText::AsNumber(Values[3]),
+				FText::AsNumber(Values[4]),
+				Values[5] ? FText::GetEmpty() : INVTEXT(" (incomplete: unsupported instruction)"));
+		case EDiagnosticRule::WidgetPerFrameUpdates:
+			return FText::Format(
+				INVTEXT("Per-frame updates: {0} (max per widget: {1}); Function Bindings: {2}; Property Bindings: {3}; "
+						"Tick: {4}"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]),
+				FText::AsNumber(Values[2]),
+				FText::AsNumber(Values[3]),
+				FText::AsNumber(Values[4]));
+		case EDiagnosticRule::WidgetBindingNodeCount:
+			return FText::Format(
+				INVTEXT("Node count of function evaluated every frame by a property binding: {0} (max: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::WidgetBindingCyclomaticComplexity:
+			return FText::Format(
+				INVTEXT("Cyclomatic complexity of function evaluated every frame by a property binding: {0} "
+						"(max: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::InstanceBytes:
+			return FText::Format(
+				INVTEXT("Bytes added to every instance: {0} (max per blueprint: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::ComponentCount:
+			return FText::Format(
+				INVTEXT("Components per instance: {0} (max: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::InstanceFootprint:
+			return FText::Format(
+				INVTEXT("Bytes per Instance: {0} (Properties: {1}; Event Graph Frame: {2}; Default Container Elements: "
+						"{3}); Components per Instance: {4} (Construction Script: {5}; Add Component Nodes: {6})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]),
+				FText::AsNumber(Values[2]),
+				FText::AsNumber(Values[3]),
+				FText::AsNumber(Values[4]),
+				FText::AsNumber(Values[5]),
+				FText::AsNumber(Values[6]));
+		case EDiagnosticRule::BlueprintCast:
+			return INVTEXT("Blueprint casts are disallowed unless explicitly whitelisted to prevent unwanted asset "
+						   "reference chains.  Cast to an interface or a C++ base class instead.");
+		case EDiagnosticRule::DisallowedFunction:
+			return FText::Format(
+				INVTEXT("Usage of this function was explicitly disallowed in the project settings. Reason: {0}"),
+				FText::AsCultureInvariant(FString(Diagnostic.Reason)));
+		case EDiagnosticRule::PerFrameCall:
+		{
+			const auto* PerFrameEntry = Cast<UEdGraphNode>(Diagnostic.RelatedObject);
+			return FText::Format(
+				INVTEXT("This function is executed every frame via {0}, where it was explicitly disallowed in the "
+						"project settings. Reason: {1}"),
+				PerFrameEntry ? PerFrameEntry->GetNodeTitle(ENodeTitleType::ListView) : FText::GetEmpty(),
+				FText::AsCultureInvariant(FString(Diagnostic.Reason)));
+		}
+		case EDiagnosticRule::PureReevaluation:
+			return FText::Format(
+				INVTEXT("This pure function is evaluated about {0} times per execution of its graph (max {1}), "
+						"because pure nodes are evaluated again for every connected impure node and on every loop "
+						"iteration. Store the result in a local variable before using it in multiple nodes or in a "
+						"loop."),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::LoopNesting:
+			return FText::Format(
+				INVTEXT("Loops are nested {0} levels deep (max {1}), so the cost of this graph grows with O(n^{0}). "
+						"Innermost loop:"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::ReferencedPackageCount:
+			return FText::Format(
+				INVTEXT("Hard references load {0} packages (max: {1})"),
+				FText::AsNumber(Values[0]),
+				FText::AsNumber(Values[1]));
+		case EDiagnosticRule::ReferencedSize:
+			return FText::Format(
+				INVTEXT("Hard references load {0} on disk (max: {1})"),
+				FText::AsMemory(Values[0]),
+				FText::AsMemory(Values[1]));
+		case EDiagnosticRule::ReferencedClassSize:
+			return FText::Format(
+				INVTEXT("Hard references load {0} {1} assets with {2} on disk (max: {3})"),
+				FText::AsNumber(Values[0]),
+				FText::FromName(Diagnostic.RelatedName),
+				FText::AsMemory(Values[1]),
+				FText::AsMemory(Values[2]));
+		case EDiagnosticRule::ReferenceFootprint:
+			return FText::Format(
+				INVTEXT("Hard references load {0} packages with {1} on disk"),
+				FText::AsNumber(Values[0]),
+				FText::AsMemory(Values[1]));
+		case EDiagnosticRule::HeavyReference:
+		{
+			TStringBuilder<512> Chain;
+			for (FName ChainPackageName : Diagnostic.ReferenceChain)
+			{
+				if (Chain.Len() > 0)
+				{
+					Chain << TEXT(" -> ");
+				}
+				Chain << FPackageName::GetShortName(ChainPackageName);
+			}
+			return FText::Format(
+				INVTEXT("Heavy hard reference ({0}): {1}"),
+				FText::AsMemory(Values[0]),
+				FText::AsCultureInvariant(Chain.ToString()));
+		}
+		}
+		checkNoEntry();
+		return FText::GetEmpty();
+	}
+
+	TSharedRef<FTokenizedMessage> MakeTokenizedMessage(const FDiagnostic& Diagnostic)
+	{
+		auto TokenizedMessage = FTokenizedMessage::Create(Diagnostic.Severity);
+		if (Diagnostic.Object)
+		{
+			TokenizedMessage->AddToken(CreateGraphOrNodeToken(Diagnostic.Object));
+		}
+		else if (Diagnostic.PackageName.IsNone() == false)
+		{
+			TokenizedMessage->AddToken(FAssetNameToken::Create(Diagnostic.PackageName.ToString()));
+		}
+		TokenizedMessage->AddText(FormatDiagnosticText(Diagnostic));
+		if (Diagnostic.Rule == EDiagnosticRule::LoopNesting && Diagnostic.RelatedObject)
+		{
+			TokenizedMessage->AddToken(CreateGraphOrNodeToken(Diagnostic.RelatedObject));
+		}
+
+		if (Diagnostic.Rule == EDiagnosticRule::GraphMetrics)
+		{
+			const FString& HelpURL = GetMaintainabilityHelpURL();
+			if (HelpURL.IsEmpty() == false)
+			{
+				TokenizedMessage->AddToken(FURLToken::Create(HelpURL, INVTEXT("HELP")));
+			}
+		}
+		return TokenizedMessage;
+	}
+
+	void AnnotateNode(const FDiagnostic& Diagnostic)
+	{
+		// Diagnostics only refer to objects, but compiler messages are supposed to be written to the nodes
+		auto* Node = const_cast<UEdGraphNode*>(Cast<UEdGraphNode>(Diagnostic.Object));
+		if (Node == nullptr || Node->bHasCompilerMessage)
+		{
+			return;
+		}
+		Node->bHasCompilerMessage = true;
+		Node->ErrorMsg = FormatDiagnosticText(Diagnostic).ToString();
+		Node->ErrorType = Diagnostic.Severity;
+	}
+} // namespace OUU::BlueprintValidation
@@ -5,7 +5,11 @@
 #include "K2Node_CallFunction.h"
 #include "K2Node_DynamicCast.h"
 #include "Misc/DataValidation.h"
+#include "OUUBlueprintAnalysisCache.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintValidationRules.h"
 #include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
 #include "OUUBlueprintValidationUtils.h"
 
 bool UOUUBlueprintDisallowedNodesValidator::CanValidateAsset_Implementation(
@@ -13,7 +17,8 @@ bool UOUUBlueprintDisallowedNodesValidator::CanValidateAsset_Implementation(
 	UObject* InAsset,
 	FDataValidationContext& InContext) const
 {
-	return IsValid(Cast<UBlueprint>(InAsset));
+	return IsValid(Cast<UBlueprint>(InAsset))
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
 }
 
 EDataValidationResult UOUUBlueprintDisallowedNodesValidator::ValidateLoadedAsset_Implementation(
@@ -23,9 +28,9 @@ EDataValidationResult UOUUBlueprintDisallowedNodesValidator::ValidateLoadedAsset
 {
 	const auto& Blueprint = *CastChecked<UBlueprint>(InAsset);
 	EDataValidationResult Result = EDataValidationResult::Valid;
-	ValidateDisallowedNodes(Blueprint, [&](TSharedRef<FTokenizedMessage> Message) {
-		Context.AddMessage(Message);
-		if (Message->GetSeverity() != EMessageSeverity::Info)
+	ValidateDisallowedNodes(Blueprint, [&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+		Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+		if (Diagnostic.Severity != EMessageSeverity::Info)
 		{
 			Result = EDataValidationResult::Invalid;
 		}
@@ -33,17 +38,13 @@ EDataValidationResult UOUUBlueprintDisallowedNodesValidator::ValidateLoadedAsset
 	return Result;
 }
 
-void UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(
-	const UBlueprint& Blueprint,
-	TFunctionRef<void(TSharedRef<FTokenizedMessage>)> MessageFunction)
+namespace OUU::BlueprintValidation
 {
-	auto& Settings = UOUUBlueprintValidationSettings::Get();
-
-	TArray<UEdGraph*> AllGraphs;
-	Blueprint.GetAllGraphs(OUT AllGraphs);
-	for (auto* Graph : AllGraphs)
+	void FindDisallowedNodes(const UEdGraph& Graph, TArray<FDisallowedNodeFinding>& OutFindings)
 	{
-		for (auto Node : Graph->Nodes)
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_FindDisallowedNodes);
+		auto& Settings = UOUUBlueprintValidationSettings::Get();
+		for (auto Node : Graph.Nodes)
 		{
 			if (auto* CastNode = Cast<UK2Node_DynamicCast>(Node))
 			{
@@ -54,28 +55,9 @@ void UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(
 					const bool IsInterface = CastNode->TargetType->HasAnyClassFlags(CLASS_Interface);
 
 					if (IsBlueprintClass && IsInterface == false
-						&& Settings.AllowBlueprintCastToChildrenOf.ContainsByPredicate(
-							   [CastNode](const TSoftClassPtr<UObject>& Class) -> bool {
-								   // No need to load the class. TargetType is already fully resolved, so if the class
-								   // is in the inheritance chain this check should pass.
-								   return CastNode->TargetType->IsChildOf(Class.Get());
-							   })
-							== false)
+						&& FCompiledValidationRules::Get().IsBlueprintCastAllowed(*CastNode->TargetType) == false)
 					{
-						const auto Message = FTokenizedMessage::Create(ToMessageSeverity(Settings.CheckBlueprintCasts));
-						Message->AddToken(OUU::BlueprintValidation::CreateGraphOrNodeToken(CastNode));
-						auto Text =
-							INVTEXT("Blueprint casts are disallowed unless explicitly whitelisted to prevent unwanted "
-									"asset reference chains.  Cast to an interface or a C++ base class instead.");
-						Message->AddText(Text);
-
-						if (CastNode->bHasCompilerMessage == false)
-						{
-							CastNode->bHasCompilerMessage = true;
-							CastNode->ErrorMsg = Text.ToString();
-							CastNode->ErrorType = ToMessageSeverity(Settings.CheckBlueprintCasts);
-						}
-						MessageFunction(Message);
+						OutFindings.Add({CastNode, EDisallowedNodeType::BlueprintCast});
 					}
 				}
 			}
@@ -85,27 +67,68 @@ void UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(
 				const auto* Function = FunctionNode->GetTargetFunction();
 				if (Function && Settings.CheckDisallowedFunctions != EOUUBlueprintValidationSeverity::DoNotValidate)
 				{
-					auto FunctionPath = Function->GetPathName();
-					if (auto* Reason = Settings.DisallowedFunctionPaths.Find(FunctionPath))
+					if (auto* Reason = FCompiledValidationRules::Get().FindDisallowedFunctionReason(*Function))
 					{
-						const auto Message =
-							FTokenizedMessage::Create(ToMessageSeverity(Settings.CheckDisallowedFunctions));
-						Message->AddToken(OUU::BlueprintValidation::CreateGraphOrNodeToken(FunctionNode));
-						auto Text = FText::Format(
-							INVTEXT("Usage of this function was explicitly disallowed in the project settings. Reason: "
-									"{0}"),
-							FText::AsCultureInvariant(*Reason));
-						Message->AddText(Text);
-						if (FunctionNode->bHasCompilerMessage == false)
-						{
-							FunctionNode->bHasCompilerMessage = true;
-							FunctionNode->ErrorMsg = Text.ToString();
-							FunctionNode->ErrorType = ToMessageSeverity(Settings.CheckDisallowedFunctions);
-						}
-						MessageFunction(Message);
+						OutFindings.Add({FunctionNode, EDisallowedNodeType::DisallowedFunction, *Reason});
 					}
 				}
 			}
 		}
 	}
+
+	void FindDisallowedNodes(const UBlueprint& Blueprint, TArray<FDisallowedNodeFinding>& OutFindings)
+	{
+		auto& AnalysisCache = FGraphAnalysisCache::Get();
+
+		TArray<UEdGraph*> AllGraphs;
+		Blueprint.GetAllGraphs(OUT AllGraphs);
+		for (auto* Graph : AllGraphs)
+		{
+			const auto* CachedFindings = AnalysisCache.FindDisallowedNodes(*Graph);
+			FScopedBlueprintValidationTimer::AddGraph(*Graph, CachedFindings != nullptr);
+			if (CachedFindings)
+			{
+				OutFindings.Append(*CachedFindings);
+				continue;
+			}
+
+			const uint64 ChangeStamp = AnalysisCache.GetChangeStamp(*Graph);
+			TArray<FDisallowedNodeFinding> Findings;
+			FindDisallowedNodes(*Graph, OUT Findings);
+			OutFindings.Append(Findings);
+			AnalysisCache.AddDisallowedNodes(*Graph, ChangeStamp, MoveTemp(Findings));
+		}
+	}
+} // namespace OUU::BlueprintValidation
+
+void UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction)
+{
+	using namespace OUU::BlueprintValidation;
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidateDisallowedNodes);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	FScopedBlueprintValidationTimer Timer(Blueprint);
+
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+
+	TArray<FDisallowedNodeFinding> Findings;
+	FindDisallowedNodes(Blueprint, OUT Findings);
+
+	for (auto& Finding : Findings)
+	{
+		auto* Node = Finding.Node.Get();
+		if (Node == nullptr)
+		{
+			continue;
+		}
+
+		const bool IsBlueprintCast = Finding.Type == EDisallowedNodeType::BlueprintCast;
+		FDiagnostic Diagnostic{
+			IsBlueprintCast ? EDiagnosticRule::BlueprintCast : EDiagnosticRule::DisallowedFunction,
+			ToMessageSeverity(IsBlueprintCast ? Settings.CheckBlueprintCasts : Settings.CheckDisallowedFunctions),
+			Node};
+		Diagnostic.Reason = Finding.Reason;
+		DiagnosticFunction(Diagnostic);
+	}
 }
@@ -0,0 +1,132 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintFunctionPatternMatcher.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOUUFunctionPatternMatcher, Log, All);
+
+namespace OUU::BlueprintValidation
+{
+	static bool HasWildcards(const FString& Pattern)
+	{
+		return Pattern.Contains(TEXT("*")) || Pattern.Contains(TEXT("?"));
+	}
+
+	FFunctionPatternMatcher::FFunctionPatternMatcher(const TMap<FString, FString>& PatternsAndReasons)
+	{
+		for (auto& PatternAndReason : PatternsAndReasons)
+		{
+			const FString& Pattern = PatternAndReason.Key;
+			FString ClassPattern, FunctionPattern;
+			// Split at the last colon, so class paths with subobjects are kept intact
+			const bool IsValidPattern = Pattern.Split(
+											TEXT(":"),
+											&ClassPattern,
+											&FunctionPattern,
+											ESearchCase::CaseSensitive,
+											ESearchDir::FromEnd)
+				&& ClassPattern.Len() > 0 && FunctionPattern.Len() > 0;
+			if (IsValidPattern == false)
+			{
+				UE_LOG(
+					LogOUUFunctionPatternMatcher,
+					Warning,
+					TEXT("Invalid function pattern '%s'. Expected format: <ClassPath>:<FunctionName>"),
+					*Pattern);
+				continue;
+			}
+
+			const int32 ReasonIdx = Reasons.Add(PatternAndReason.Value);
+			if (HasWildcards(ClassPattern))
+			{
+				WildcardPatterns.Add({ClassPattern, FunctionPattern, ReasonIdx});
+				continue;
+			}
+
+			const FTopLevelAssetPath ClassPath(ClassPattern);
+			if (ClassPath.IsValid() == false)
+			{
+				UE_LOG(
+					LogOUUFunctionPatternMatcher,
+					Warning,
+					TEXT("Invalid class path '%s' in function pattern '%s'"),
+					*ClassPattern,
+					*Pattern);
+				continue;
+			}
+
+			if (HasWildcards(FunctionPattern))
+			{
+				ClassFunctionPatterns.FindOrAdd(ClassPath).Add({ClassPattern, FunctionPattern, ReasonIdx});
+			}
+			else
+			{
+				ExactFunctionPatterns.FindOrAdd(MakeTuple(ClassPath, FName(*FunctionPattern)), ReasonIdx);
+			}
+		}
+	}
+
+	const FString* FFunctionPatternMatcher::Match(const UFunction& Function)
+	{
+		if (IsEmpty())
+		{
+			return nullptr;
+		}
+
+		const FObjectKey FunctionKey(&Function);
+		const int32* MemoizedReasonIdx = MemoizedResults.Find(FunctionKey);
+		const int32 ReasonIdx =
+			MemoizedReasonIdx ? *MemoizedReasonIdx : MemoizedResults.Add(FunctionKey, MatchUncached(Function));
+		return Reasons.IsValidIndex(ReasonIdx) ? &Reasons[ReasonIdx] : nullptr;
+	}
+
+	void FFunctionPatternMatcher::ResetMemoizedResults() { MemoizedResults.Reset(); }
+
+	int32 FFunctionPatternMatcher::MatchUncached(const UFunction& Function) const
+	{
+		// All functions that can be called from blueprints are owned by classes
+		const auto* OwnerClass = Cast<UClass>(Function.GetOuter());
+		if (OwnerClass == nullptr)
+		{
+			return INDEX_NONE;
+		}
+
+		const FTopLevelAssetPath ClassPath(OwnerClass);
+		if (const int32* ReasonIdx = ExactFunctionPatterns.Find(MakeTuple(ClassPath, Function.GetFName())))
+		{
+			return *ReasonIdx;
+		}
+
+		const auto* FunctionPatterns = ClassFunctionPatterns.Find(ClassPath);
+		if (FunctionPatterns == nullptr && WildcardPatterns.IsEmpty())
+		{
+			return INDEX_NONE;
+		}
+
+		const FString FunctionName = Function.GetName();
+		if (FunctionPatterns)
+		{
+			for (auto& Pattern : *FunctionPatterns)
+			{
+				if (FunctionName.MatchesWildcard(Pattern.FunctionPattern, ESearchCase::IgnoreCase))
+				{
+					return Pattern.ReasonIdx;
+				}
+			}
+		}
+
+		if (WildcardPatterns.Num() > 0)
+		{
+			const FString ClassPathString = ClassPath.ToString();
+			for (auto& Pattern : WildcardPatterns)
+			{
+				if (ClassPathString.MatchesWildcard(Pattern.ClassPattern, ESearchCase::IgnoreCase)
+					&& FunctionName.MatchesWildcard(Pattern.FunctionPattern, ESearchCase::IgnoreCase))
+				{
+					return Pattern.ReasonIdx;
+				}
+			}
+		}
+
+		return INDEX_NONE;
+	}
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,55 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/ObjectKey.h"
+#include "UObject/TopLevelAssetPath.h"
+
+namespace OUU::BlueprintValidation
+{
+	// Matches functions against function path patterns from the project settings.
+	// Patterns have the form <ClassPath>:<FunctionName>, e.g. /Script/Engine.KismetSystemLibrary:LoadAsset_Blocking
+	// Both parts may contain * and ? wildcards, e.g. /Script/Engine.KismetSystemLibrary:*Blocking* or
+	// /Script/Engine.KismetSystemLibrary:* for all functions of a class.
+	//
+	// Patterns without wildcards are compiled into name keys, so matching them does not require building any strings.
+	// The match result is memoized per function, so wildcard patterns are only evaluated once per function.
+	class FFunctionPatternMatcher
+	{
+	public:
+		FFunctionPatternMatcher() = default;
+		explicit FFunctionPatternMatcher(const TMap<FString, FString>& PatternsAndReasons);
+
+		bool IsEmpty() const { return Reasons.IsEmpty(); }
+
+		// @returns the reason configured for the first matching pattern or nullptr if no pattern matches.
+		// Not thread safe, because the results are memoized.
+		const FString* Match(const UFunction& Function);
+
+		void ResetMemoizedResults();
+
+	private:
+		struct FWildcardPattern
+		{
+			FString ClassPattern;
+			FString FunctionPattern;
+			int32 ReasonIdx = INDEX_NONE;
+		};
+
+		int32 MatchUncached(const UFunction& Function) const;
+
+		TArray<FString> Reasons;
+
+		// Patterns without any wildcards
+		TMap<TPair<FTopLevelAssetPath, FName>, int32> ExactFunctionPatterns;
+		// Patterns with function name wildcards for specific classes
+		TMap<FTopLevelAssetPath, TArray<FWildcardPattern>> ClassFunctionPatterns;
+		// Patterns with class wildcards that have to be checked for all functions
+		TArray<FWildcardPattern> WildcardPatterns;
+
+		// Reason index (or INDEX_NONE) per function
+		TMap<FObjectKey, int32> MemoizedResults;
+	};
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,144 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintGraphSnapshot.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "EdGraphSchema_K2.h"
+#include "Hash/Blake3.h"
+#include "K2Node.h"
+#include "K2Node_ExecutionSequence.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+
+namespace OUU::BlueprintValidation
+{
+	EGraphNodeFlags GetGraphNodeFlags(UEdGraphNode& Node)
+	{
+		EGraphNodeFlags Flags = EGraphNodeFlags::None;
+		if (Node.IsA<UEdGraphNode_Comment>() || Node.NodeComment.Len() > 0)
+		{
+			Flags |= EGraphNodeFlags::Comment;
+		}
+		if (IsValid(&Node) && IsBlueprintEntryNode(Node))
+		{
+			Flags |= EGraphNodeFlags::Entry;
+		}
+		if (Node.IsA<UK2Node_ExecutionSequence>())
+		{
+			Flags |= EGraphNodeFlags::ExecutionSequence;
+		}
+		if (auto* K2Node = Cast<UK2Node>(&Node))
+		{
+			Flags |= EGraphNodeFlags::K2Node;
+			if (K2Node->IsNodePure())
+			{
+				Flags |= EGraphNodeFlags::Pure;
+			}
+		}
+		return Flags;
+	}
+
+	FGraphSnapshot BuildGraphSnapshot(UEdGraph& Graph)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_BuildGraphSnapshot);
+		OUU_BPV_TRACE_OBJECT_SCOPE(&Graph);
+		FGraphSnapshot Snapshot;
+		const int32 NumNodes = Graph.Nodes.Num();
+
+		TMap<const UEdGraphNode*, int32> NodeIndices;
+		NodeIndices.Reserve(NumNodes);
+		for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+		{
+			if (IsValid(Graph.Nodes[NodeIdx]))
+			{
+				NodeIndices.Add(Graph.Nodes[NodeIdx], NodeIdx);
+			}
+		}
+		auto FindOwningNodeIndex = [&NodeIndices](const UEdGraphPin& Pin) -> int32 {
+			const int32* NodeIdx = NodeIndices.Find(Pin.GetOwningNodeUnchecked());
+			return NodeIdx ? *NodeIdx : INDEX_NONE;
+		};
+
+		Snapshot.NodeFlags.SetNumZeroed(NumNodes);
+		Snapshot.ExecOutOffsets.Reserve(NumNodes + 1);
+		Snapshot.ParamPinOffsets.Reserve(NumNodes + 1);
+		Snapshot.ParamLinkOffsets.Add(0);
+
+		for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+		{
+			Snapshot.ExecOutOffsets.Add(Snapshot.ExecOutTargetNodes.Num());
+			Snapshot.ParamPinOffsets.Add(Snapshot.NumParamPins());
+
+			UEdGraphNode* Node = Graph.Nodes[NodeIdx];
+			if (Node == nullptr)
+			{
+				continue;
+			}
+
+			Snapshot.NodeFlags[NodeIdx] = GetGraphNodeFlags(*Node);
+
+			for (auto* Pin : Node->Pins)
+			{
+				if (Pin == nullptr)
+				{
+					continue;
+				}
+
+				const bool IsExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+				if (IsExecPin && Pin->Direction == EGPD_Output)
+				{
+					if (Pin->LinkedTo.IsEmpty())
+					{
+						Snapshot.ExecOutTargetNodes.Add(INDEX_NONE);
+						Snapshot.ExecOutTargetPins.Add(INDEX_NONE);
+					}
+					else
+					{
+						// exec OUT pins are always just connected to a single other pin and node
+						const auto* LinkedPin = Pin->LinkedTo[0];
+						const auto* LinkedNode = LinkedPin->GetOwningNodeUnchecked();
+						Snapshot.ExecOutTargetNodes.Add(FindOwningNodeIndex(*LinkedPin));
+						Snapshot.ExecOutTargetPins.Add(LinkedNode ? LinkedNode->Pins.IndexOfByKey(LinkedPin) : 0);
+					}
+				}
+				else if (IsExecPin == false && Pin->Direction == EGPD_Input)
+				{
+					// interpret all non exec inputs of a node as a "parameter"
+					for (const auto* LinkedPin : Pin->LinkedTo)
+					{
+						Snapshot.ParamLinkSourceNodes.Add(FindOwningNodeIndex(*LinkedPin));
+					}
+					Snapshot.ParamLinkOffsets.Add(Snapshot.ParamLinkSourceNodes.Num());
+				}
+			}
+		}
+
+		Snapshot.ExecOutOffsets.Add(Snapshot.ExecOutTargetNodes.Num());
+		Snapshot.ParamPinOffsets.Add(Snapshot.NumParamPins());
+
+		return Snapshot;
+	}
+
+	template <typename ElementType>
+	static void AppendArrayToHash(FBlake3& Hasher, const TArray<ElementType>& Array)
+	{
+		// Include the size, so elements can't shift between adjacent arrays without changing the hash
+		const int32 Num = Array.Num();
+		Hasher.Update(&Num, sizeof(Num));
+		Hasher.Update(Array.GetData(), Array.Num() * sizeof(ElementType));
+	}
+
+	FIoHash HashGraphSnapshot(const FGraphSnapshot& Snapshot)
+	{
+		FBlake3 Hasher;
+		AppendArrayToHash(Hasher, Snapshot.NodeFlags);
+		AppendArrayToHash(Hasher, Snapshot.ExecOutOffsets);
+		AppendArrayToHash(Hasher, Snapshot.ExecOutTargetNodes);
+		AppendArrayToHash(Hasher, Snapshot.ExecOutTargetPins);
+		AppendArrayToHash(Hasher, Snapshot.ParamPinOffsets);
+		AppendArrayToHash(Hasher, Snapshot.ParamLinkOffsets);
+		AppendArrayToHash(Hasher, Snapshot.ParamLinkSourceNodes);
+		return FIoHash(Hasher.Finalize());
+	}
+} // namespace OUU::BlueprintValidation
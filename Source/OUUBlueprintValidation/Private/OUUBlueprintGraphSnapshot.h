@@ -0,0 +1,152 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "IO/IoHash.h"
+#include "OUUBlueprintComplexity.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+namespace OUU::BlueprintValidation
+{
+	enum class EGraphNodeFlags : uint8
+	{
+		None = 0,
+		// Node is a UK2Node. Only those are considered for lines of code and halstead complexity.
+		K2Node = 1 << 0,
+		// Node is a pure K2 node (no exec pins)
+		Pure = 1 << 1,
+		// see IsBlueprintEntryNode()
+		Entry = 1 << 2,
+		// Execution sequence nodes do not add branches to the cyclomatic complexity
+		ExecutionSequence = 1 << 3,
+		// Comment node or node with a node comment
+		Comment = 1 << 4,
+	};
+	ENUM_CLASS_FLAGS(EGraphNodeFlags);
+
+	// Immutable, UObject-free representation of a blueprint graph that contains all information required to compute
+	// the graph metrics. Building it is the only part of metric computation that touches UObjects.
+	//
+	// Nodes are referenced by their index in UEdGraph::Nodes. All per-pin data is stored in flat arrays that are
+	// indexed via offset arrays (compressed sparse row layout), e.g. the exec outputs of node N are stored at
+	// [ExecOutOffsets[N], ExecOutOffsets[N + 1]).
+	struct FGraphSnapshot
+	{
+		int32 NumNodes() const { return NodeFlags.Num(); }
+
+		bool HasAnyFlags(int32 NodeIdx, EGraphNodeFlags Flags) const
+		{
+			return EnumHasAnyFlags(NodeFlags[NodeIdx], Flags);
+		}
+
+		bool IsPureK2Node(int32 NodeIdx) const
+		{
+			return EnumHasAllFlags(NodeFlags[NodeIdx], EGraphNodeFlags::K2Node | EGraphNodeFlags::Pure);
+		}
+
+		TArrayView<const int32> GetExecOutTargetNodes(int32 NodeIdx) const
+		{
+			return MakeArrayView(ExecOutTargetNodes)
+				.Slice(ExecOutOffsets[NodeIdx], ExecOutOffsets[NodeIdx + 1] - ExecOutOffsets[NodeIdx]);
+		}
+
+		TArrayView<const int32> GetExecOutTargetPins(int32 NodeIdx) const
+		{
+			return MakeArrayView(ExecOutTargetPins)
+				.Slice(ExecOutOffsets[NodeIdx], ExecOutOffsets[NodeIdx + 1] - ExecOutOffsets[NodeIdx]);
+		}
+
+		int32 NumParamPins() const { return ParamLinkOffsets.Num() - 1; }
+
+		int32 GetFirstParamPin(int32 NodeIdx) const { return ParamPinOffsets[NodeIdx]; }
+		int32 GetNumParamPins(int32 NodeIdx) const { return ParamPinOffsets[NodeIdx + 1] - ParamPinOffsets[NodeIdx]; }
+
+		bool IsParamPinLinked(int32 ParamPinIdx) const
+		{
+			return ParamLinkOffsets[ParamPinIdx + 1] > ParamLinkOffsets[ParamPinIdx];
+		}
+
+		TArrayView<const int32> GetParamPinSourceNodes(int32 ParamPinIdx) const
+		{
+			const int32 FirstLink = ParamLinkOffsets[ParamPinIdx];
+			return MakeArrayView(ParamLinkSourceNodes).Slice(FirstLink, ParamLinkOffsets[ParamPinIdx + 1] - FirstLink);
+		}
+
+		TArray<EGraphNodeFlags> NodeFlags;
+
+		// Exec output pins of all nodes. Size: NumNodes + 1
+		TArray<int32> ExecOutOffsets;
+		// Index of the node connected to the exec output pin.
+		// INDEX_NONE if the pin is disconnected or the connected node is not part of the graph.
+		TArray<int32> ExecOutTargetNodes;
+		// Index of the connected pin within its owning node or INDEX_NONE if the exec output pin is disconnected.
+		TArray<int32> ExecOutTargetPins;
+
+		// Input parameter pins (all non-exec inputs) of all nodes. Size: NumNodes + 1
+		TArray<int32> ParamPinOffsets;
+		// Links of the parameter pins. Size: NumParamPins + 1
+		// Pins without links are literal operands. Every one of them is a distinct operand, even if another pin holds
+		// the same value.
+		TArray<int32> ParamLinkOffsets;
+		// Index of the node owning the linked output pin or INDEX_NONE if that node is not part of the graph.
+		TArray<int32> ParamLinkSourceNodes;
+	};
+
+	// Pure nodes of a graph viewed as a DAG of expressions that are consumed by impure nodes.
+	struct FPureExpressionInfo
+	{
+		// Per node: How often a pure node is evaluated per execution of all impure nodes that consume it directly or
+		// via other pure nodes (or per execution of the graph if parameter pin evaluation counts were passed).
+		// Shared subexpressions are counted once per path to an impure node, so this is an upper bound.
+		// 0 for impure nodes and for pure nodes that are not consumed by any impure node.
+		TArray<uint32> EvaluationCounts;
+	};
+
+	// Flags of a single node as stored in graph snapshots. Must be called on the game thread.
+	EGraphNodeFlags GetGraphNodeFlags(UEdGraphNode& Node);
+
+	// Build a snapshot of a single blueprint graph. Must be called on the game thread.
+	FGraphSnapshot BuildGraphSnapshot(UEdGraph& Graph);
+
+	// Hash of the complete structure of a snapshot. Snapshots with the same hash have the same metrics.
+	// Does not access any UObjects.
+	FIoHash HashGraphSnapshot(const FGraphSnapshot& Snapshot);
+
+	// Analyze all pure expressions of a graph in linear time. Each pure node is only processed once, no matter how many
+	// impure nodes it feeds.
+	// @param ParamPinEvaluationCounts Optional: How often each parameter pin of impure nodes is evaluated per execution
+	//	of the graph, e.g. to account for loops. By default every impure node evaluates each of its inputs once.
+	FPureExpressionInfo AnalyzePureExpressions(
+		const FGraphSnapshot& Snapshot,
+		TConstArrayView<uint32> ParamPinEvaluationCounts = {});
+
+	// Compute the graph metrics from a snapshot. This does not access any UObjects.
+	FGraphMetrics ComputeGraphMetrics(const FGraphSnapshot& Snapshot);
+
+	// Contribution of a single node to the exec flow counts of the cyclomatic complexities
+	struct FExecOutputCounts
+	{
+		// Additional execution paths according to our lenient (Galea) counting
+		int32 Branches = 0;
+		// Edges of the exec control flow graph for the McCabe formula
+		int32 Edges = 0;
+	};
+
+	constexpr uint64 DisconnectedExecOutput = MAX_uint64;
+
+	// Count the exec flow contribution of a node from its exec outputs.
+	// ExecOutTargets contains one id per exec output that identifies the connected pin (same id = same pin) or
+	// DisconnectedExecOutput for disconnected outputs.
+	FExecOutputCounts CountExecOutputs(TConstArrayView<uint64> ExecOutTargets, bool IsExecutionSequence);
+
+	FHalsteadComplexity ComputeHalsteadComplexity(
+		uint32 NumberOfUniqueOperators,
+		uint32 NumberOfUniqueOperands,
+		uint32 NumberOfTotalOperators,
+		uint32 NumberOfTotalOperands);
+
+} // namespace OUU::BlueprintValidation
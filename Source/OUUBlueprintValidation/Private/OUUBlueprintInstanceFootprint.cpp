@@ -0,0 +1,103 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintInstanceFootprint.h"
+
+#include "Algo/Count.h"
+#include "Components/ActorComponent.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UnrealType.h"
+
+namespace OUU::BlueprintValidation
+{
+	// Heap memory of the elements of a container property value, without nested allocations of the elements
+	static int64 GetContainerElementBytes(const FProperty& Property, const void* ValuePtr)
+	{
+		if (auto* ArrayProperty = CastField<FArrayProperty>(&Property))
+		{
+			return static_cast<int64>(FScriptArrayHelper(ArrayProperty, ValuePtr).Num())
+				* ArrayProperty->Inner->GetSize();
+		}
+		if (auto* SetProperty = CastField<FSetProperty>(&Property))
+		{
+			return static_cast<int64>(FScriptSetHelper(SetProperty, ValuePtr).Num()) * SetProperty->SetLayout.Size;
+		}
+		if (auto* MapProperty = CastField<FMapProperty>(&Property))
+		{
+			return static_cast<int64>(FScriptMapHelper(MapProperty, ValuePtr).Num())
+				* MapProperty->MapLayout.SetLayout.Size;
+		}
+		return 0;
+	}
+
+	static int32 CountNativeComponents(const UClass& Class)
+	{
+		const UClass* NativeClass = &Class;
+		while (NativeClass && NativeClass->HasAnyClassFlags(CLASS_Native) == false)
+		{
+			NativeClass = NativeClass->GetSuperClass();
+		}
+		UObject* NativeDefaultObject = NativeClass ? NativeClass->GetDefaultObject(false) : nullptr;
+		if (NativeDefaultObject == nullptr)
+		{
+			return 0;
+		}
+
+		TArray<UObject*> DefaultSubobjects;
+		NativeDefaultObject->GetDefaultSubobjects(OUT DefaultSubobjects);
+		return Algo::CountIf(DefaultSubobjects, [](const UObject* Subobject) {
+			return Subobject && Subobject->IsA<UActorComponent>();
+		});
+	}
+
+	FInstanceFootprint ComputeInstanceFootprint(const UBlueprintGeneratedClass& GeneratedClass)
+	{
+		FInstanceFootprint Footprint;
+
+		const UClass* SuperClass = GeneratedClass.GetSuperClass();
+		Footprint.PropertyBytes =
+			FMath::Max(0, GeneratedClass.GetPropertiesSize() - (SuperClass ? SuperClass->GetPropertiesSize() : 0));
+
+		if (GeneratedClass.UberGraphFunction && UBlueprintGeneratedClass::UsePersistentUberGraphFrame())
+		{
+			Footprint.UbergraphFrameBytes = GeneratedClass.UberGraphFunction->GetStructureSize();
+		}
+
+		if (const UObject* DefaultObject = GeneratedClass.GetDefaultObject(false))
+		{
+			int64 DefaultContainerBytes = 0;
+			for (TFieldIterator<FProperty> It(&GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+			{
+				for (int32 ArrayIdx = 0; ArrayIdx < It->ArrayDim; ++ArrayIdx)
+				{
+					DefaultContainerBytes +=
+						GetContainerElementBytes(**It, It->ContainerPtrToValuePtr<void>(DefaultObject, ArrayIdx));
+				}
+			}
+			Footprint.DefaultContainerBytes = static_cast<int32>(FMath::Min<int64>(DefaultContainerBytes, MAX_int32));
+		}
+
+		if (GeneratedClass.IsChildOf<AActor>() == false)
+		{
+			return Footprint;
+		}
+
+		// Every blueprint class of the chain adds its own construction script components and "Add Component" templates
+		for (auto* Class = &GeneratedClass; Class; Class = Cast<UBlueprintGeneratedClass>(Class->GetSuperClass()))
+		{
+			const int32 NumNodes =
+				Class->SimpleConstructionScript ? Class->SimpleConstructionScript->GetAllNodes().Num() : 0;
+			const int32 NumTemplates = Class->ComponentTemplates.Num();
+			Footprint.Components += NumNodes + NumTemplates;
+			if (Class == &GeneratedClass)
+			{
+				Footprint.ConstructionScriptComponents = NumNodes;
+				Footprint.ComponentTemplates = NumTemplates;
+			}
+		}
+		Footprint.Components += CountNativeComponents(GeneratedClass);
+		return Footprint;
+	}
+} // namespace OUU::BlueprintValidation
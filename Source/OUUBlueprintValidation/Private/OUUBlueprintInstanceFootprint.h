@@ -0,0 +1,37 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprintGeneratedClass;
+
+namespace OUU::BlueprintValidation
+{
+	// Memory and components that every instance of a blueprint class carries, based on its generated class.
+	// Byte counts only include what the blueprint adds on top of its parent class.
+	struct FInstanceFootprint
+	{
+		// Size of the properties added by the blueprint (variables, timelines, component references, etc) including
+		// alignment padding
+		int32 PropertyBytes = 0;
+		// Size of the persistent ubergraph frame, i.e. the local state of the event graphs that is kept per instance
+		int32 UbergraphFrameBytes = 0;
+		// Heap memory of the default elements of arrays, sets and maps added by the blueprint. The defaults are copied
+		// to every instance. Nested containers are not taken into account.
+		int32 DefaultContainerBytes = 0;
+
+		// Components of an actor instance: Native default subobjects of the native base class, construction script
+		// components and templates of "Add Component" nodes (assuming each is added once) of this and all parent
+		// blueprints
+		int32 Components = 0;
+		// Construction script components added by this blueprint
+		int32 ConstructionScriptComponents = 0;
+		// Templates of "Add Component" nodes of this blueprint
+		int32 ComponentTemplates = 0;
+
+		int32 GetInstanceBytes() const { return PropertyBytes + UbergraphFrameBytes + DefaultContainerBytes; }
+	};
+
+	FInstanceFootprint ComputeInstanceFootprint(const UBlueprintGeneratedClass& GeneratedClass);
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,98 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintInstanceFootprintValidator.h"
+
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Misc/DataValidation.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintInstanceFootprint.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+
+bool UOUUBlueprintInstanceFootprintValidator::CanValidateAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& InContext) const
+{
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	return IsValid(Cast<UBlueprint>(InAsset))
+		&& Settings.CheckInstanceFootprint != EOUUBlueprintValidationSeverity::DoNotValidate
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
+}
+
+EDataValidationResult UOUUBlueprintInstanceFootprintValidator::ValidateLoadedAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& Context)
+{
+	const auto& Blueprint = *CastChecked<UBlueprint>(InAsset);
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	ValidateInstanceFootprint(
+		Blueprint,
+		[&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+			Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+			if (Diagnostic.Severity != EMessageSeverity::Info)
+			{
+				Result = EDataValidationResult::Invalid;
+			}
+		},
+		UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+	return Result;
+}
+
+void UOUUBlueprintInstanceFootprintValidator::ValidateInstanceFootprint(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+	bool LogFootprint)
+{
+	using namespace OUU::BlueprintValidation;
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	auto* GeneratedClass = Cast<UBlueprintGeneratedClass>(Blueprint.GeneratedClass);
+	if (GeneratedClass == nullptr
+		|| Settings.CheckInstanceFootprint == EOUUBlueprintValidationSeverity::DoNotValidate)
+	{
+		return;
+	}
+
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidateInstanceFootprint);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	FScopedBlueprintValidationTimer Timer(Blueprint);
+	const EMessageSeverity::Type FailureSeverity = ToMessageSeverity(Settings.CheckInstanceFootprint);
+
+	const FInstanceFootprint Footprint = ComputeInstanceFootprint(*GeneratedClass);
+
+	bool AnyBudgetExceeded = false;
+	if (Footprint.GetInstanceBytes() > Settings.MaxInstanceBytesAddedByBlueprint)
+	{
+		AnyBudgetExceeded = true;
+		DiagnosticFunction(FDiagnostic{
+			EDiagnosticRule::InstanceBytes,
+			FailureSeverity,
+			nullptr,
+			{Footprint.GetInstanceBytes(), Settings.MaxInstanceBytesAddedByBlueprint}});
+	}
+	if (Footprint.Components > Settings.MaxComponentsPerInstance)
+	{
+		AnyBudgetExceeded = true;
+		DiagnosticFunction(FDiagnostic{
+			EDiagnosticRule::ComponentCount,
+			FailureSeverity,
+			nullptr,
+			{Footprint.Components, Settings.MaxComponentsPerInstance}});
+	}
+
+	if (LogFootprint || AnyBudgetExceeded)
+	{
+		DiagnosticFunction(FDiagnostic{
+			EDiagnosticRule::InstanceFootprint,
+			EMessageSeverity::Info,
+			nullptr,
+			{Footprint.GetInstanceBytes(),
+			 Footprint.PropertyBytes,
+			 Footprint.UbergraphFrameBytes,
+			 Footprint.DefaultContainerBytes,
+			 Footprint.Components,
+			 Footprint.ConstructionScriptComponents,
+			 Footprint.ComponentTemplates}});
+	}
+}
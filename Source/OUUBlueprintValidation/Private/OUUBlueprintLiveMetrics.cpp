@@ -0,0 +1,651 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintLiveMetrics.h"
+
+#include "BlueprintEditor.h"
+#include "BlueprintEditorContext.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Editor.h"
+#include "OUUBlueprintGraphSnapshot.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationUtils.h"
+#include "ToolMenus.h"
+#include "Widgets/Text/STextBlock.h"
+
+namespace OUU::BlueprintValidation
+{
+	static TUniquePtr<FLiveGraphMetrics> GLiveGraphMetrics;
+
+	using FNodeKey = TObjectKey<UEdGraphNode>;
+
+	class FLiveGraphMetrics::FGraphTracker
+	{
+	public:
+		explicit FGraphTracker(UEdGraph& InGraph) : Graph(&InGraph)
+		{
+			OnGraphChangedHandle = InGraph.AddOnGraphChangedHandler(
+				FOnGraphChanged::FDelegate::CreateRaw(this, &FGraphTracker::HandleGraphChanged));
+			// The initial build is just an update of all nodes
+			NeedsNodeSync = true;
+		}
+
+		~FGraphTracker()
+		{
+			if (auto* TrackedGraph = Graph.Get())
+			{
+				TrackedGraph->RemoveOnGraphChangedHandler(OnGraphChangedHandle);
+			}
+		}
+
+		void MarkNodeDirty(const UEdGraphNode& Node) { DirtyNodes.Add(&Node); }
+
+		// Added or removed nodes are not always reported individually, so the node list has to be checked
+		void MarkNodeListDirty() { NeedsNodeSync = true; }
+
+		FGraphMetrics GetMetrics()
+		{
+			Update();
+
+			FGraphMetrics Metrics;
+			Metrics.NodeCount = Graph.IsValid() ? Graph->Nodes.Num() : 0;
+			Metrics.CommentCount = Totals.NumComments;
+			Metrics.CyclomaticComplexity = Totals.NumEntryNodes + Totals.ReachableBranches;
+			Metrics.McCabeCyclomaticComplexity =
+				Totals.ReachableEdges - Totals.NumReachableNodes + Totals.NumExecFlowComponents;
+			Metrics.Halstead = ComputeHalsteadComplexity(
+				Totals.NumUniqueOperatorNodes,
+				Totals.NumUniqueOperandNodes + Totals.NumUniqueLiterals,
+				Totals.NumTotalOperators,
+				Totals.NumTotalOperands);
+			Metrics.LinesOfCode =
+				Totals.NumImpureNodes + (Totals.NumPureNodes / MetricConstants::PureNodesPerLineOfCode);
+			return Metrics;
+		}
+
+	private:
+		struct FExecOutput
+		{
+			// Empty if the output is disconnected or connected to a node outside of the graph
+			FNodeKey TargetNode;
+			// INDEX_NONE if the output is disconnected
+			int32 TargetPin = INDEX_NONE;
+		};
+
+		struct FNodeRecord
+		{
+			// Read from the node
+			EGraphNodeFlags Flags = EGraphNodeFlags::None;
+			TArray<FExecOutput> ExecOutputs;
+			FExecOutputCounts ExecOutputCounts;
+			int32 NumParamPins = 0;
+			// Unlinked parameter pins. Every literal pin is a distinct operand, like in graph snapshots.
+			int32 NumLiterals = 0;
+			// Distinct nodes connected to the parameter pins
+			TArray<FNodeKey> ParamSources;
+
+			// Reverse links maintained by the tracker. One entry per link.
+			TArray<FNodeKey> ExecPredecessors;
+			TArray<FNodeKey> Consumers;
+
+			// Reachable from an entry node. Only reachable nodes contribute to the cyclomatic complexity.
+			bool IsExecReachable = false;
+			// Impure node or pure node consumed by an impure node. Only those contribute to the halstead complexity.
+			bool IsHalsteadCounted = false;
+
+			bool HasFlags(EGraphNodeFlags InFlags) const { return EnumHasAllFlags(Flags, InFlags); }
+		};
+
+		// Both the exec flow and the pure expressions are tracked as nodes that are reachable from roots
+		enum class ERelation
+		{
+			// Entry nodes -> exec outputs
+			ExecFlow,
+			// Impure nodes -> parameter inputs connected to pure nodes
+			Expression
+		};
+
+		struct FTotals
+		{
+			int32 NumEntryNodes = 0;
+			// Entry nodes without exec predecessors. Updated whenever the flags or predecessors of a record change.
+			int32 NumExecFlowComponents = 0;
+			int32 NumReachableNodes = 0;
+			int32 ReachableBranches = 0;
+			int32 ReachableEdges = 0;
+			uint32 NumComments = 0;
+			uint32 NumPureNodes = 0;
+			uint32 NumImpureNodes = 0;
+			uint32 NumUniqueOperatorNodes = 0;
+			uint32 NumUniqueOperandNodes = 0;
+			uint32 NumTotalOperators = 0;
+			uint32 NumTotalOperands = 0;
+			uint32 NumUniqueLiterals = 0;
+		};
+
+		void HandleGraphChanged(const FEdGraphEditAction& Action)
+		{
+			if (Action.Nodes.Num() == 0)
+			{
+				MarkNodeListDirty();
+			}
+			for (const auto* Node : Action.Nodes)
+			{
+				if (Node)
+				{
+					MarkNodeDirty(*Node);
+				}
+			}
+		}
+
+		void SyncNodeList(const UEdGraph& InGraph)
+		{
+			for (UEdGraphNode* Node : InGraph.Nodes)
+			{
+				if (Node && Records.Contains(Node) == false)
+				{
+					DirtyNodes.Add(Node);
+				}
+			}
+			if (Records.Num() + DirtyNodes.Num() > InGraph.Nodes.Num())
+			{
+				TSet<FNodeKey> GraphNodes;
+				GraphNodes.Reserve(InGraph.Nodes.Num());
+				for (UEdGraphNode* Node : InGraph.Nodes)
+				{
+					GraphNodes.Add(Node);
+				}
+				for (auto& Entry : Records)
+				{
+					if (GraphNodes.Contains(Entry.Key) == false)
+					{
+						DirtyNodes.Add(Entry.Key);
+					}
+				}
+			}
+			NeedsNodeSync = false;
+		}
+
+		void Update()
+		{
+			auto* TrackedGraph = Graph.Get();
+			if (TrackedGraph == nullptr)
+			{
+				return;
+			}
+			if (NeedsNodeSync)
+			{
+				SyncNodeList(*TrackedGraph);
+			}
+			if (DirtyNodes.IsEmpty())
+			{
+				return;
+			}
+
+			// Nodes whose links to other nodes changed. Their reachability has to be re-evaluated.
+			TSet<FNodeKey> ExecFlowSeeds, ExpressionSeeds;
+			for (const FNodeKey& NodeKey : DirtyNodes)
+			{
+				ExecFlowSeeds.Add(NodeKey);
+				ExpressionSeeds.Add(NodeKey);
+
+				if (auto* OldRecord = Records.Find(NodeKey))
+				{
+					SetReachable(ERelation::ExecFlow, *OldRecord, false);
+					SetReachable(ERelation::Expression, *OldRecord, false);
+					AddNodeCounts(*OldRecord, -1);
+					for (auto& ExecOutput : OldRecord->ExecOutputs)
+					{
+						if (auto* TargetRecord = Records.Find(ExecOutput.TargetNode))
+						{
+							RemoveExecPredecessor(*TargetRecord, NodeKey);
+							ExecFlowSeeds.Add(ExecOutput.TargetNode);
+						}
+					}
+					for (auto& SourceKey : OldRecord->ParamSources)
+					{
+						if (auto* SourceRecord = Records.Find(SourceKey))
+						{
+							SourceRecord->Consumers.RemoveSingleSwap(NodeKey, EAllowShrinking::No);
+							ExpressionSeeds.Add(SourceKey);
+						}
+					}
+				}
+
+				auto* Node = NodeKey.ResolveObjectPtr();
+				if (Node == nullptr || Node->GetGraph() != TrackedGraph || TrackedGraph->Nodes.Contains(Node) == false)
+				{
+					if (auto* RemovedRecord = Records.Find(NodeKey))
+					{
+						AddExecFlowComponentCount(*RemovedRecord, -1);
+						Records.Remove(NodeKey);
+					}
+					continue;
+				}
+
+				FNodeRecord NewRecord = ReadNode(*Node, *TrackedGraph);
+				for (auto& ExecOutput : NewRecord.ExecOutputs)
+				{
+					if (ExecOutput.TargetNode != FNodeKey())
+					{
+						AddExecPredecessor(Records.FindOrAdd(ExecOutput.TargetNode), NodeKey);
+						ExecFlowSeeds.Add(ExecOutput.TargetNode);
+					}
+				}
+				for (auto& SourceKey : NewRecord.ParamSources)
+				{
+					Records.FindOrAdd(SourceKey).Consumers.Add(NodeKey);
+					ExpressionSeeds.Add(SourceKey);
+				}
+
+				// Reverse links are owned by the other nodes
+				auto& Record = Records.FindOrAdd(NodeKey);
+				AddExecFlowComponentCount(Record, -1);
+				NewRecord.ExecPredecessors = MoveTemp(Record.ExecPredecessors);
+				NewRecord.Consumers = MoveTemp(Record.Consumers);
+				Record = MoveTemp(NewRecord);
+				AddNodeCounts(Record, 1);
+				AddExecFlowComponentCount(Record, 1);
+			}
+			DirtyNodes.Reset();
+
+			UpdateReachability(ERelation::ExecFlow, ExecFlowSeeds);
+			UpdateReachability(ERelation::Expression, ExpressionSeeds);
+		}
+
+		FNodeRecord ReadNode(UEdGraphNode& Node, const UEdGraph& InGraph)
+		{
+			FNodeRecord Record;
+			Record.Flags = GetGraphNodeFlags(Node);
+
+			TArray<uint64, TInlineAllocator<16>> ExecOutTargets;
+			for (const auto* Pin : Node.Pins)
+			{
+				if (Pin == nullptr)
+				{
+					continue;
+				}
+
+				const bool IsExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+				if (IsExecPin && Pin->Direction == EGPD_Output)
+				{
+					FExecOutput& ExecOutput = Record.ExecOutputs.AddDefaulted_GetRef();
+					if (Pin->LinkedTo.IsEmpty())
+					{
+						ExecOutTargets.Add(DisconnectedExecOutput);
+						continue;
+					}
+
+					// exec OUT pins are always just connected to a single other pin and node
+					const auto* LinkedPin = Pin->LinkedTo[0];
+					auto* LinkedNode = LinkedPin->GetOwningNodeUnchecked();
+					ExecOutput.TargetPin = LinkedNode ? LinkedNode->Pins.IndexOfByKey(LinkedPin) : 0;
+					if (LinkedNode && LinkedNode->GetGraph() == &InGraph)
+					{
+						ExecOutput.TargetNode = LinkedNode;
+					}
+					ExecOutTargets.Add(
+						(static_cast<uint64>(LinkedNode ? GUObjectArray.ObjectToIndex(LinkedNode) : INDEX_NONE) << 32)
+						| static_cast<uint32>(ExecOutput.TargetPin));
+				}
+				else if (IsExecPin == false && Pin->Direction == EGPD_Input)
+				{
+					// interpret all non exec inputs of a node as a "parameter"
+					Record.NumParamPins++;
+					if (Pin->LinkedTo.IsEmpty())
+					{
+						Record.NumLiterals++;
+						continue;
+					}
+					for (const auto* LinkedPin : Pin->LinkedTo)
+					{
+						auto* LinkedNode = LinkedPin->GetOwningNodeUnchecked();
+						if (LinkedNode && LinkedNode != &Node && LinkedNode->GetGraph() == &InGraph)
+						{
+							Record.ParamSources.AddUnique(LinkedNode);
+						}
+					}
+				}
+			}
+
+			Record.ExecOutputCounts =
+				CountExecOutputs(ExecOutTargets, Record.HasFlags(EGraphNodeFlags::ExecutionSequence));
+			return Record;
+		}
+
+		// Counts that only depend on the node itself
+		void AddNodeCounts(const FNodeRecord& Record, int32 Sign)
+		{
+			if (Record.HasFlags(EGraphNodeFlags::Comment))
+			{
+				Totals.NumComments += Sign;
+			}
+			if (Record.HasFlags(EGraphNodeFlags::Entry))
+			{
+				Totals.NumEntryNodes += Sign;
+			}
+			if (Record.HasFlags(EGraphNodeFlags::K2Node))
+			{
+				(Record.HasFlags(EGraphNodeFlags::Pure) ? Totals.NumPureNodes : Totals.NumImpureNodes) += Sign;
+			}
+		}
+
+		// Entry nodes that are not reached from other nodes start their own exec flow component
+		void AddExecFlowComponentCount(const FNodeRecord& Record, int32 Sign)
+		{
+			if (Record.HasFlags(EGraphNodeFlags::Entry) && Record.ExecPredecessors.IsEmpty())
+			{
+				Totals.NumExecFlowComponents += Sign;
+			}
+		}
+
+		void AddExecPredecessor(FNodeRecord& Record, const FNodeKey& Predecessor)
+		{
+			AddExecFlowComponentCount(Record, -1);
+			Record.ExecPredecessors.Add(Predecessor);
+			AddExecFlowComponentCount(Record, 1);
+		}
+
+		void RemoveExecPredecessor(FNodeRecord& Record, const FNodeKey& Predecessor)
+		{
+			AddExecFlowComponentCount(Record, -1);
+			Record.ExecPredecessors.RemoveSingleSwap(Predecessor, EAllowShrinking::No);
+			AddExecFlowComponentCount(Record, 1);
+		}
+
+		bool IsRoot(ERelation Relation, const FNodeRecord& Record) const
+		{
+			return Relation == ERelation::ExecFlow
+				? Record.HasFlags(EGraphNodeFlags::Entry)
+				: Record.HasFlags(EGraphNodeFlags::K2Node) && Record.HasFlags(EGraphNodeFlags::Pure) == false;
+		}
+
+		// Can the node be reached from other nodes (as opposed to only being a root)?
+		bool CanBeReached(ERelation Relation, const FNodeRecord& Record) const
+		{
+			return Relation == ERelation::ExecFlow
+				|| Record.HasFlags(EGraphNodeFlags::K2Node | EGraphNodeFlags::Pure);
+		}
+
+		bool IsReachable(ERelation Relation, const FNodeRecord& Record) const
+		{
+			return Relation == ERelation::ExecFlow ? Record.IsExecReachable : Record.IsHalsteadCounted;
+		}
+
+		const TArray<FNodeKey>& GetPredecessors(ERelation Relation, const FNodeRecord& Record) const
+		{
+			return Relation == ERelation::ExecFlow ? Record.ExecPredecessors : Record.Consumers;
+		}
+
+		template <typename FunctionType>
+		void ForEachSuccessor(ERelation Relation, const FNodeRecord& Record, FunctionType&& Function) const
+		{
+			if (Relation == ERelation::Expression)
+			{
+				for (auto& SourceKey : Record.ParamSources)
+				{
+					Function(SourceKey);
+				}
+				return;
+			}
+			for (auto& ExecOutput : Record.ExecOutputs)
+			{
+				if (ExecOutput.TargetNode != FNodeKey())
+				{
+					Function(ExecOutput.TargetNode);
+				}
+			}
+		}
+
+		void SetReachable(ERelation Relation, FNodeRecord& Record, bool Reachable)
+		{
+			if (IsReachable(Relation, Record) == Reachable)
+			{
+				return;
+			}
+
+			const int32 Sign = Reachable ? 1 : -1;
+			if (Relation == ERelation::ExecFlow)
+			{
+				Record.IsExecReachable = Reachable;
+				Totals.NumReachableNodes += Sign;
+				Totals.ReachableBranches += Sign * Record.ExecOutputCounts.Branches;
+				Totals.ReachableEdges += Sign * Record.ExecOutputCounts.Edges;
+				return;
+			}
+
+			Record.IsHalsteadCounted = Reachable;
+			const bool IsPure = Record.HasFlags(EGraphNodeFlags::Pure);
+			if (IsPure)
+			{
+				Totals.NumTotalOperators += Sign;
+			}
+			if (IsPure && Record.NumParamPins == 0)
+			{
+				// Nodes that are not functions but variables / property access / etc that have no parameter pins
+				Totals.NumUniqueOperandNodes += Sign;
+				return;
+			}
+
+			Totals.NumUniqueOperatorNodes += Sign;
+			Totals.NumTotalOperands += Sign * Record.NumLiterals;
+			Totals.NumUniqueLiterals += Sign * Record.NumLiterals;
+		}
+
+		// Incremental reachability update after the links of the seed nodes changed.
+		// All reachable nodes downstream of the seeds might have lost their connection to a root, so they are
+		// marked unreachable first. Then they are reached again from roots or from reachable nodes outside of that
+		// region. This only touches the region connected to the changed nodes and also works for cyclic graphs.
+		void UpdateReachability(ERelation Relation, const TSet<FNodeKey>& Seeds)
+		{
+			TArray<FNodeKey> Worklist = Seeds.Array();
+			TSet<FNodeKey> AffectedNodes;
+			while (Worklist.Num() > 0)
+			{
+				const FNodeKey NodeKey = Worklist.Pop(EAllowShrinking::No);
+				bool IsAlreadyAffected = false;
+				AffectedNodes.Add(NodeKey, &IsAlreadyAffected);
+				auto* Record = Records.Find(NodeKey);
+				if (IsAlreadyAffected || Record == nullptr || IsReachable(Relation, *Record) == false)
+				{
+					continue;
+				}
+				SetReachable(Relation, *Record, false);
+				ForEachSuccessor(Relation, *Record, [&](const FNodeKey& Successor) { Worklist.Add(Successor); });
+			}
+
+			for (const FNodeKey& NodeKey : AffectedNodes)
+			{
+				const auto* Record = Records.Find(NodeKey);
+				if (Record == nullptr)
+				{
+					continue;
+				}
+				const bool HasReachablePredecessor = CanBeReached(Relation, *Record)
+					&& GetPredecessors(Relation, *Record).ContainsByPredicate([&](const FNodeKey& Predecessor) {
+						   const auto* PredecessorRecord = Records.Find(Predecessor);
+						   return PredecessorRecord && IsReachable(Relation, *PredecessorRecord);
+					   });
+				if (IsRoot(Relation, *Record) || HasReachablePredecessor)
+				{
+					Worklist.Add(NodeKey);
+				}
+			}
+
+			while (Worklist.Num() > 0)
+			{
+				const FNodeKey NodeKey = Worklist.Pop(EAllowShrinking::No);
+				auto* Record = Records.Find(NodeKey);
+				if (Record == nullptr || IsReachable(Relation, *Record))
+				{
+					continue;
+				}
+				SetReachable(Relation, *Record, true);
+				ForEachSuccessor(Relation, *Record, [&](const FNodeKey& Successor) {
+					const auto* SuccessorRecord = Records.Find(Successor);
+					if (SuccessorRecord && IsReachable(Relation, *SuccessorRecord) == false
+						&& CanBeReached(Relation, *SuccessorRecord))
+					{
+						Worklist.Add(Successor);
+					}
+				});
+			}
+		}
+
+		TWeakObjectPtr<UEdGraph> Graph;
+		FDelegateHandle OnGraphChangedHandle;
+
+		TMap<FNodeKey, FNodeRecord> Records;
+		TSet<FNodeKey> DirtyNodes;
+		bool NeedsNodeSync = false;
+
+		FTotals Totals;
+	};
+
+	void FLiveGraphMetrics::Startup() { GLiveGraphMetrics = TUniquePtr<FLiveGraphMetrics>(new FLiveGraphMetrics()); }
+
+	void FLiveGraphMetrics::Shutdown() { GLiveGraphMetrics.Reset(); }
+
+	FLiveGraphMetrics& FLiveGraphMetrics::Get()
+	{
+		check(IsInGameThread());
+		return *GLiveGraphMetrics;
+	}
+
+	FLiveGraphMetrics::FLiveGraphMetrics()
+	{
+		FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FLiveGraphMetrics::HandleObjectModified);
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FLiveGraphMetrics::HandlePostGarbageCollect);
+		// Undo/redo restores objects without modifying them, so we can't know which nodes were affected
+		FEditorDelegates::PostUndoRedo.AddRaw(this, &FLiveGraphMetrics::Reset);
+	}
+
+	FLiveGraphMetrics::~FLiveGraphMetrics()
+	{
+		FCoreUObjectDelegates::OnObjectModified.RemoveAll(this);
+		FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+		FEditorDelegates::PostUndoRedo.RemoveAll(this);
+		if (UObjectInitialized())
+		{
+			Reset();
+		}
+	}
+
+	FGraphMetrics FLiveGraphMetrics::GetMetrics(UEdGraph& Graph)
+	{
+		auto& Tracker = Trackers.FindOrAdd(&Graph);
+		if (Tracker.IsValid() == false)
+		{
+			Tracker = MakeUnique<FGraphTracker>(Graph);
+		}
+		return Tracker->GetMetrics();
+	}
+
+	void FLiveGraphMetrics::HandleObjectModified(UObject* Object)
+	{
+		if (auto* Node = Cast<UEdGraphNode>(Object))
+		{
+			// Also covers pin links and default values, which are modified via their owning nodes
+			if (auto* Tracker = Trackers.Find(Node->GetGraph()))
+			{
+				(*Tracker)->MarkNodeDirty(*Node);
+			}
+		}
+		else if (auto* Graph = Cast<UEdGraph>(Object))
+		{
+			if (auto* Tracker = Trackers.Find(Graph))
+			{
+				(*Tracker)->MarkNodeListDirty();
+			}
+		}
+	}
+
+	void FLiveGraphMetrics::HandlePostGarbageCollect()
+	{
+		for (auto It = Trackers.CreateIterator(); It; ++It)
+		{
+			if (It->Key.ResolveObjectPtr() == nullptr)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	void FLiveGraphMetrics::Reset() { Trackers.Reset(); }
+
+	static const FName LiveMetricsToolMenuOwner = TEXT("OUUBlueprintValidation.LiveMetrics");
+
+	static UEdGraph* GetFocusedBlueprintGraph(const TWeakPtr<FBlueprintEditor>& WeakBlueprintEditor)
+	{
+		const auto BlueprintEditor = WeakBlueprintEditor.Pin();
+		auto* Graph = BlueprintEditor.IsValid() ? BlueprintEditor->GetFocusedGraph() : nullptr;
+		return Graph && IsBlueprintGraph(*Graph) ? Graph : nullptr;
+	}
+
+	static FText GetLiveMetricsText(const TWeakPtr<FBlueprintEditor> WeakBlueprintEditor)
+	{
+		auto* Graph = GetFocusedBlueprintGraph(WeakBlueprintEditor);
+		if (Graph == nullptr)
+		{
+			return FText::GetEmpty();
+		}
+
+		auto& Settings = UOUUBlueprintValidationSettings::Get();
+		const auto Metrics = FLiveGraphMetrics::Get().GetMetrics(*Graph);
+		const double GraphComplexity = Settings.CyclomaticComplexityMode == EOUUCyclomaticComplexityMode::McCabe
+			? Metrics.McCabeCyclomaticComplexity
+			: Metrics.CyclomaticComplexity;
+		const double MaintainabilityIndex =
+			ComputeMicrosoftMaintainabilityIndex(Metrics.Halstead.Volume, GraphComplexity, Metrics.LinesOfCode);
+		return FText::Format(
+			INVTEXT("MI: {0} | CC: {1} | HV: {2} | Nodes: {3}"),
+			FText::AsNumber(FMath::RoundToInt(MaintainabilityIndex)),
+			FText::AsNumber(FMath::RoundToInt(GraphComplexity)),
+			FText::AsNumber(FMath::RoundToInt(Metrics.Halstead.Volume)),
+			FText::AsNumber(Metrics.NodeCount));
+	}
+
+	static void ExtendBlueprintEditorToolbar()
+	{
+		FToolMenuOwnerScoped OwnerScoped(LiveMetricsToolMenuOwner);
+		auto* Toolbar = UToolMenus::Get()->ExtendMenu(TEXT("AssetEditor.BlueprintEditor.ToolBar"));
+		Toolbar->AddDynamicSection(
+			TEXT("OUULiveMetrics"),
+			FNewToolMenuDelegate::CreateLambda([](UToolMenu* Menu) {
+				const auto* Context = Menu->FindContext<UBlueprintEditorToolMenuContext>();
+				auto& Settings = UOUUBlueprintValidationSettings::Get();
+				if (Context == nullptr || Settings.ShowLiveMetricsInBlueprintEditor == false)
+				{
+					return;
+				}
+
+				const TWeakPtr<FBlueprintEditor> WeakBlueprintEditor = Context->BlueprintEditor;
+				auto& Section = Menu->AddSection(TEXT("OUULiveMetrics"));
+				Section.AddEntry(FToolMenuEntry::InitWidget(
+					TEXT("OUULiveMetrics"),
+					SNew(STextBlock)
+						.Text_Static(&GetLiveMetricsText, WeakBlueprintEditor)
+						.ToolTipText(INVTEXT("Live metrics of the focused graph: Maintainability Index, Cyclomatic "
+											 "Complexity, Halstead Volume and Node Count"))
+						.Visibility_Lambda([WeakBlueprintEditor]() {
+							return GetFocusedBlueprintGraph(WeakBlueprintEditor) ? EVisibility::Visible
+																				 : EVisibility::Collapsed;
+						}),
+					FText::GetEmpty()));
+			}));
+	}
+
+	void RegisterLiveMetricsToolbar()
+	{
+		UToolMenus::RegisterStartupCallback(
+			FSimpleMulticastDelegate::FDelegate::CreateStatic(&ExtendBlueprintEditorToolbar));
+	}
+
+	void UnregisterLiveMetricsToolbar()
+	{
+		if (UToolMenus::TryGet())
+		{
+			UToolMenus::UnregisterOwner(LiveMetricsToolMenuOwner);
+		}
+	}
+} // namespace OUU::BlueprintValidation
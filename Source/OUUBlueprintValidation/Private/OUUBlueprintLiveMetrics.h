@@ -0,0 +1,48 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "OUUBlueprintComplexity.h"
+#include "UObject/ObjectKey.h"
+
+class UEdGraph;
+
+namespace OUU::BlueprintValidation
+{
+	// Graph metrics that are kept up to date incrementally while graphs are edited, so they can be displayed live in
+	// the blueprint editor.
+	// Nodes are collected when they are modified, added or removed. When the metrics are queried, only those nodes
+	// are read again and only the exec flow and pure expression regions that are connected to them are re-evaluated.
+	// Must only be used from the game thread.
+	class FLiveGraphMetrics
+	{
+	public:
+		// Called by the module
+		static void Startup();
+		static void Shutdown();
+
+		static FLiveGraphMetrics& Get();
+
+		~FLiveGraphMetrics();
+
+		// Current metrics of a blueprint graph. The graph is tracked from the first call on.
+		FGraphMetrics GetMetrics(UEdGraph& Graph);
+
+	private:
+		class FGraphTracker;
+
+		FLiveGraphMetrics();
+
+		void HandleObjectModified(UObject* Object);
+		void HandlePostGarbageCollect();
+		void Reset();
+
+		TMap<TObjectKey<UEdGraph>, TUniquePtr<FGraphTracker>> Trackers;
+	};
+
+	// Show the live metrics of the focused graph in the blueprint editor toolbar. Called by the module.
+	void RegisterLiveMetricsToolbar();
+	void UnregisterLiveMetricsToolbar();
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,306 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintLoopAnalysis.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Composite.h"
+#include "K2Node_MacroInstance.h"
+#include "OUUBlueprintGraphSnapshot.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+
+namespace OUU::BlueprintValidation
+{
+	TBitArray<> FindExecCycleNodes(const FGraphSnapshot& Snapshot)
+	{
+		// Nodes can reach themselves iff they are part of a strongly connected component with more than one node or
+		// have a self loop. The components are found with a single iterative pass of Tarjan's algorithm.
+		const int32 NumNodes = Snapshot.NumNodes();
+		TBitArray<> CycleNodes(false, NumNodes);
+		TBitArray<> OnComponentStack(false, NumNodes);
+		TArray<int32> VisitIndices;
+		VisitIndices.Init(INDEX_NONE, NumNodes);
+		TArray<int32> LowLinks;
+		LowLinks.SetNumUninitialized(NumNodes);
+		TArray<int32> ComponentStack;
+		// Depth first search path: Node and index of its next exec output to follow
+		TArray<TPair<int32, int32>> SearchPath;
+		int32 NextVisitIndex = 0;
+
+		auto VisitNode = [&](int32 NodeIdx) {
+			VisitIndices[NodeIdx] = LowLinks[NodeIdx] = NextVisitIndex++;
+			ComponentStack.Add(NodeIdx);
+			OnComponentStack[NodeIdx] = true;
+			SearchPath.Emplace(NodeIdx, 0);
+		};
+
+		for (int32 RootNodeIdx = 0; RootNodeIdx < NumNodes; ++RootNodeIdx)
+		{
+			if (VisitIndices[RootNodeIdx] != INDEX_NONE)
+			{
+				continue;
+			}
+
+			VisitNode(RootNodeIdx);
+			while (SearchPath.Num() > 0)
+			{
+				const int32 NodeIdx = SearchPath.Last().Key;
+				const auto ExecOutTargetNodes = Snapshot.GetExecOutTargetNodes(NodeIdx);
+				if (SearchPath.Last().Value < ExecOutTargetNodes.Num())
+				{
+					const int32 TargetNodeIdx = ExecOutTargetNodes[SearchPath.Last().Value++];
+					if (TargetNodeIdx == INDEX_NONE)
+					{
+						continue;
+					}
+					if (TargetNodeIdx == NodeIdx)
+					{
+						CycleNodes[NodeIdx] = true;
+					}
+					if (VisitIndices[TargetNodeIdx] == INDEX_NONE)
+					{
+						VisitNode(TargetNodeIdx);
+					}
+					else if (OnComponentStack[TargetNodeIdx])
+					{
+						LowLinks[NodeIdx] = FMath::Min(LowLinks[NodeIdx], VisitIndices[TargetNodeIdx]);
+					}
+					continue;
+				}
+
+				SearchPath.Pop(EAllowShrinking::No);
+				if (SearchPath.Num() > 0)
+				{
+					int32& ParentLowLink = LowLinks[SearchPath.Last().Key];
+					ParentLowLink = FMath::Min(ParentLowLink, LowLinks[NodeIdx]);
+				}
+
+				if (LowLinks[NodeIdx] == VisitIndices[NodeIdx])
+				{
+					// NodeIdx is the root of a component that consists of all nodes above it on the stack
+					const bool IsCycle = ComponentStack.Last() != NodeIdx;
+					int32 ComponentNodeIdx;
+					do
+					{
+						ComponentNodeIdx = ComponentStack.Pop(EAllowShrinking::No);
+						OnComponentStack[ComponentNodeIdx] = false;
+						if (IsCycle)
+						{
+							CycleNodes[ComponentNodeIdx] = true;
+						}
+					} while (ComponentNodeIdx != NodeIdx);
+				}
+			}
+		}
+		return CycleNodes;
+	}
+
+	bool IsLoopBodyTrigger(const FGraphSnapshot& Snapshot, const TBitArray<>& CycleNodes, int32 NodeIdx)
+	{
+		return CycleNodes[NodeIdx] && Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::ExecutionSequence);
+	}
+
+	class FLoopNestingAnalyzer
+	{
+	public:
+		explicit FLoopNestingAnalyzer(const UBlueprint& InBlueprint) : Blueprint(InBlueprint) {}
+
+		struct FGraphLoopNesting
+		{
+			int32 MaxDepth = 0;
+			UEdGraphNode* InnermostLoopNode = nullptr;
+			// Loop depth at which the exec outputs of macros and collapsed graphs are executed, by pin name
+			TMap<FName, int32> OutputDepths;
+		};
+
+		const FGraphLoopNesting& AnalyzeGraph(UEdGraph& Graph)
+		{
+			if (const auto* ExistingResult = Results.Find(&Graph))
+			{
+				return *ExistingResult;
+			}
+
+			// Recursive function calls are cut by the empty placeholder
+			Results.Add(&Graph);
+			FGraphLoopNesting Result = AnalyzeGraphUncached(Graph);
+			return Results[&Graph] = MoveTemp(Result);
+		}
+
+	private:
+		// Depths are capped, so exec cycles through loop bodies can't increase them indefinitely
+		static constexpr int32 MaxTrackedDepth = 16;
+
+		UEdGraph* FindNestedGraph(UEdGraphNode& Node) const
+		{
+			if (auto* MacroNode = Cast<UK2Node_MacroInstance>(&Node))
+			{
+				return MacroNode->GetMacroGraph();
+			}
+			if (auto* CompositeNode = Cast<UK2Node_Composite>(&Node))
+			{
+				return CompositeNode->BoundGraph;
+			}
+			if (auto* CallNode = Cast<UK2Node_CallFunction>(&Node))
+			{
+				const auto* Function = CallNode->GetTargetFunction();
+				const auto* OwnerClass = Function ? Function->GetOwnerClass() : nullptr;
+				if (OwnerClass && OwnerClass->ClassGeneratedBy == &Blueprint)
+				{
+					for (UEdGraph* FunctionGraph : Blueprint.FunctionGraphs)
+					{
+						if (FunctionGraph && FunctionGraph->GetFName() == Function->GetFName())
+						{
+							return FunctionGraph;
+						}
+					}
+				}
+			}
+			return nullptr;
+		}
+
+		FGraphLoopNesting AnalyzeGraphUncached(UEdGraph& Graph)
+		{
+			const FGraphSnapshot Snapshot = BuildGraphSnapshot(Graph);
+			const TBitArray<> CycleNodes = FindExecCycleNodes(Snapshot);
+			const int32 NumNodes = Snapshot.NumNodes();
+
+			// Nested loop depths of all nodes with a nested graph
+			TArray<int32> NestedMaxDepths;
+			NestedMaxDepths.Init(0, NumNodes);
+			TArray<TMap<FName, int32>> NestedOutputDepths;
+			NestedOutputDepths.SetNum(NumNodes);
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+			{
+				UEdGraphNode* Node = Graph.Nodes[NodeIdx];
+				auto* NestedGraph = Node ? FindNestedGraph(*Node) : nullptr;
+				if (NestedGraph && NestedGraph != &Graph)
+				{
+					const auto& NestedResult = AnalyzeGraph(*NestedGraph);
+					NestedMaxDepths[NodeIdx] = NestedResult.MaxDepth;
+					NestedOutputDepths[NodeIdx] = NestedResult.OutputDepths;
+				}
+			}
+
+			auto GetOutputDepth = [&](int32 NodeIdx, const UEdGraphPin& Pin, int32 InputDepth, int32 TargetNodeIdx) {
+				int32 Depth = InputDepth + NestedOutputDepths[NodeIdx].FindRef(Pin.PinName);
+				if (IsLoopBodyTrigger(Snapshot, CycleNodes, NodeIdx)
+					&& (TargetNodeIdx == INDEX_NONE || CycleNodes[TargetNodeIdx] == false))
+				{
+					Depth++;
+				}
+				return FMath::Min(Depth, MaxTrackedDepth);
+			};
+
+			// Propagate the loop depths at which nodes are executed along the exec flow
+			TArray<int32> InputDepths;
+			InputDepths.Init(0, NumNodes);
+			TArray<int32> Worklist;
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+			{
+				if (Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::Entry))
+				{
+					Worklist.Add(NodeIdx);
+				}
+			}
+			while (Worklist.Num() > 0)
+			{
+				const int32 NodeIdx = Worklist.Pop(EAllowShrinking::No);
+				const auto ExecOutTargetNodes = Snapshot.GetExecOutTargetNodes(NodeIdx);
+				int32 ExecOutIdx = 0;
+				for (const auto* Pin : Graph.Nodes[NodeIdx]->Pins)
+				{
+					if (Pin == nullptr || Pin->Direction != EGPD_Output
+						|| Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+					{
+						continue;
+					}
+
+					const int32 TargetNodeIdx = ExecOutTargetNodes[ExecOutIdx++];
+					if (TargetNodeIdx == INDEX_NONE)
+					{
+						continue;
+					}
+					const int32 TargetDepth = GetOutputDepth(NodeIdx, *Pin, InputDepths[NodeIdx], TargetNodeIdx);
+					if (TargetDepth > InputDepths[TargetNodeIdx])
+					{
+						InputDepths[TargetNodeIdx] = TargetDepth;
+						Worklist.Add(TargetNodeIdx);
+					}
+				}
+			}
+
+			FGraphLoopNesting Result;
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+			{
+				UEdGraphNode* Node = Graph.Nodes[NodeIdx];
+				if (Node == nullptr)
+				{
+					continue;
+				}
+
+				const int32 Depth = InputDepths[NodeIdx] + (CycleNodes[NodeIdx] ? 1 : 0) + NestedMaxDepths[NodeIdx];
+				if (Depth > Result.MaxDepth)
+				{
+					Result.MaxDepth = FMath::Min(Depth, MaxTrackedDepth);
+					Result.InnermostLoopNode = Node;
+				}
+
+				// Exit tunnel of macros and collapsed graphs
+				auto* Tunnel = Cast<UK2Node_Tunnel>(Node);
+				if (Tunnel == nullptr || Tunnel->bCanHaveInputs == false || Tunnel->IsA<UK2Node_MacroInstance>()
+					|| Tunnel->IsA<UK2Node_Composite>())
+				{
+					continue;
+				}
+				for (const auto* Pin : Tunnel->Pins)
+				{
+					if (Pin == nullptr || Pin->Direction != EGPD_Input
+						|| Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+					{
+						continue;
+					}
+					for (const auto* LinkedPin : Pin->LinkedTo)
+					{
+						const int32 SourceNodeIdx = Graph.Nodes.IndexOfByKey(LinkedPin->GetOwningNodeUnchecked());
+						if (SourceNodeIdx != INDEX_NONE)
+						{
+							int32& OutputDepth = Result.OutputDepths.FindOrAdd(Pin->PinName);
+							OutputDepth = FMath::Max(
+								OutputDepth,
+								GetOutputDepth(SourceNodeIdx, *LinkedPin, InputDepths[SourceNodeIdx], NodeIdx));
+						}
+					}
+				}
+			}
+			return Result;
+		}
+
+		const UBlueprint& Blueprint;
+		TMap<const UEdGraph*, FGraphLoopNesting> Results;
+	};
+
+	void ComputeLoopNestingDepths(const UBlueprint& Blueprint, TArray<FLoopNesting>& OutLoopNestings)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ComputeLoopNesting);
+		FLoopNestingAnalyzer Analyzer(Blueprint);
+		for (const auto* Graphs : {&Blueprint.UbergraphPages, &Blueprint.FunctionGraphs, &Blueprint.MacroGraphs})
+		{
+			for (UEdGraph* Graph : *Graphs)
+			{
+				if (Graph == nullptr || IsBlueprintGraph(*Graph) == false)
+				{
+					continue;
+				}
+
+				const auto& Nesting = Analyzer.AnalyzeGraph(*Graph);
+				if (Nesting.MaxDepth > 0)
+				{
+					OutLoopNestings.Add({Graph, Nesting.InnermostLoopNode, Nesting.MaxDepth});
+				}
+			}
+		}
+	}
+} // namespace OUU::BlueprintValidation
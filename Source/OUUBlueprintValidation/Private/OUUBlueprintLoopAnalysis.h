@@ -0,0 +1,38 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+
+namespace OUU::BlueprintValidation
+{
+	struct FGraphSnapshot;
+
+	// Nodes that can reach themselves via exec links, i.e. that are executed on every iteration of a loop.
+	// Loop macros (e.g. ForEachLoop) are implemented with such exec cycles in their macro graphs.
+	// Linear in the number of nodes and exec links.
+	TBitArray<> FindExecCycleNodes(const FGraphSnapshot& Snapshot);
+
+	// Whether the exec outputs of a node that lead out of its exec cycle are executed once per loop iteration.
+	// This is the case for sequence nodes within loops, which continue the loop after their first outputs (e.g.
+	// "Loop Body" of ForEachLoop). Outputs of other nodes within loops (e.g. the branch checking the loop condition)
+	// exit the loop.
+	bool IsLoopBodyTrigger(const FGraphSnapshot& Snapshot, const TBitArray<>& CycleNodes, int32 NodeIdx);
+
+	struct FLoopNesting
+	{
+		TWeakObjectPtr<UEdGraph> Graph;
+		// Loop macro, collapsed graph or function call that contains the innermost loop
+		TWeakObjectPtr<UEdGraphNode> InnermostLoopNode;
+		// Maximum number of nested loops, i.e. the cost of the graph grows with O(n^Depth)
+		int32 Depth = 0;
+	};
+
+	// Compute the loop nesting depth of all event graphs, functions and macros of a blueprint that contain loops.
+	// Loops are followed into macros, collapsed graphs and functions of the same blueprint.
+	void ComputeLoopNestingDepths(const UBlueprint& Blueprint, TArray<FLoopNesting>& OutLoopNestings);
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,75 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintLoopNestingValidator.h"
+
+#include "Misc/DataValidation.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintLoopAnalysis.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+
+bool UOUUBlueprintLoopNestingValidator::CanValidateAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& InContext) const
+{
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	return IsValid(Cast<UBlueprint>(InAsset))
+		&& Settings.CheckLoopNesting != EOUUBlueprintValidationSeverity::DoNotValidate
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
+}
+
+EDataValidationResult UOUUBlueprintLoopNestingValidator::ValidateLoadedAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& Context)
+{
+	const auto& Blueprint = *CastChecked<UBlueprint>(InAsset);
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	ValidateLoopNesting(Blueprint, [&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+		Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+		if (Diagnostic.Severity != EMessageSeverity::Info)
+		{
+			Result = EDataValidationResult::Invalid;
+		}
+	});
+	return Result;
+}
+
+void UOUUBlueprintLoopNestingValidator::ValidateLoopNesting(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction)
+{
+	using namespace OUU::BlueprintValidation;
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidateLoopNesting);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	FScopedBlueprintValidationTimer Timer(Blueprint);
+
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	if (Settings.CheckLoopNesting == EOUUBlueprintValidationSeverity::DoNotValidate)
+	{
+		return;
+	}
+
+	TArray<FLoopNesting> LoopNestings;
+	ComputeLoopNestingDepths(Blueprint, OUT LoopNestings);
+
+	const auto Severity = ToMessageSeverity(Settings.CheckLoopNesting);
+	for (auto& LoopNesting : LoopNestings)
+	{
+		auto* Graph = LoopNesting.Graph.Get();
+		if (Graph == nullptr || LoopNesting.Depth <= Settings.MaxLoopNestingDepth)
+		{
+			continue;
+		}
+
+		FDiagnostic Diagnostic{
+			EDiagnosticRule::LoopNesting,
+			Severity,
+			Graph,
+			{LoopNesting.Depth, Settings.MaxLoopNestingDepth}};
+		Diagnostic.RelatedObject = LoopNesting.InnermostLoopNode.Get();
+		DiagnosticFunction(Diagnostic);
+	}
+}
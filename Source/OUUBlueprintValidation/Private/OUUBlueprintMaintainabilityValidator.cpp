@@ -2,10 +2,13 @@
 #include "OUUBlueprintMaintainabilityValidator.h"
 
 #include "EdGraph/EdGraph.h"
-#include "Interfaces/IPluginManager.h"
 #include "Misc/DataValidation.h"
+#include "OUUBlueprintAnalysisCache.h"
+#include "OUUBlueprintAssetRegistryTags.h"
 #include "OUUBlueprintComplexity.h"
+#include "OUUBlueprintDiagnostics.h"
 #include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
 #include "OUUBlueprintValidationUtils.h"
 
 bool UOUUBlueprintMaintainabilityValidator::CanValidateAsset_Implementation(
@@ -16,9 +19,11 @@ bool UOUUBlueprintMaintainabilityValidator::CanValidateAsset_Implementation(
 	// Theoretically we could also limit this to only some context (e.g. skip when saving because it likely happens
 	// together with compilation, but this is not that much duplicate work if save on compile is enabled and keeps it
 	// more consistent).
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
 	return IsValid(Cast<UBlueprint>(InAsset))
-		&& UOUUBlueprintValidationSettings::Get().CheckMaintainabilityMetrics
-		!= EOUUBlueprintValidationSeverity::DoNotValidate;
+		&& Settings.CheckMaintainabilityMetrics != EOUUBlueprintValidationSeverity::DoNotValidate
+		// Always validate if metrics should be logged. Otherwise skip blueprints that are known to pass validation.
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
 }
 
 EDataValidationResult UOUUBlueprintMaintainabilityValidator::ValidateLoadedAsset_Implementation(
@@ -30,9 +35,9 @@ EDataValidationResult UOUUBlueprintMaintainabilityValidator::ValidateLoadedAsset
 	EDataValidationResult Result = EDataValidationResult::Valid;
 	ValidateMaintainability(
 		Blueprint,
-		[&](TSharedRef<FTokenizedMessage> Message) {
-			Context.AddMessage(Message);
-			if (Message->GetSeverity() != EMessageSeverity::Info)
+		[&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+			Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+			if (Diagnostic.Severity != EMessageSeverity::Info)
 			{
 				Result = EDataValidationResult::Invalid;
 			}
@@ -43,28 +48,35 @@ EDataValidationResult UOUUBlueprintMaintainabilityValidator::ValidateLoadedAsset
 
 void UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(
 	const UBlueprint& Blueprint,
-	TFunctionRef<void(TSharedRef<FTokenizedMessage>)> MessageFunction,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
 	bool LogMetrics)
 {
+	using OUU::BlueprintValidation::EDiagnosticRule;
+	using OUU::BlueprintValidation::FDiagnostic;
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidateMaintainability);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	OUU::BlueprintValidation::FScopedBlueprintValidationTimer Timer(Blueprint);
+
 	auto& Settings = UOUUBlueprintValidationSettings::Get();
-	auto MakeGraphMessage =
-		[&](EMessageSeverity::Type Severity, UEdGraph& Graph, FText&& Message) -> TSharedRef<FTokenizedMessage> {
-		auto TokenizedMessage = FTokenizedMessage::Create(Severity);
-		TokenizedMessage->AddToken(OUU::BlueprintValidation::CreateGraphOrNodeToken(&Graph));
-		TokenizedMessage->AddText(Message);
-		return TokenizedMessage;
-	};
+	const EMessageSeverity::Type FailureSeverity = ToMessageSeverity(Settings.CheckMaintainabilityMetrics);
 
 	bool AnyGraphRuleFailed = false;
-	auto ConditionallyAddMessage = [&](bool Failed, UEdGraph& Graph, FText&& Message) {
-		if (Failed == false)
-		{
-			return;
-		}
-		AnyGraphRuleFailed = true;
-		MessageFunction(
-			MakeGraphMessage(ToMessageSeverity(Settings.CheckMaintainabilityMetrics), Graph, MoveTemp(Message)));
-	};
+	auto ConditionallyAddDiagnostic =
+		[&](bool Failed,
+			UEdGraph& Graph,
+			EDiagnosticRule Rule,
+			std::initializer_list<int64> Values,
+			double Limit = 0.0) {
+			if (Failed == false)
+			{
+				return;
+			}
+			AnyGraphRuleFailed = true;
+			FDiagnostic Diagnostic{Rule, FailureSeverity, &Graph};
+			Diagnostic.SetValues(Values);
+			Diagnostic.Limit = Limit;
+			DiagnosticFunction(Diagnostic);
+		};
 
 	TArray<UEdGraph*> Graphs;
 	Blueprint.GetAllGraphs(OUT Graphs);
@@ -73,32 +85,47 @@ void UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(
 	const bool TooManyGraphs = NumBlueprintGraphs > Settings.MaxGraphsPerBlueprint;
 	if (TooManyGraphs || LogMetrics)
 	{
-		MessageFunction(FTokenizedMessage::Create(
-			TooManyGraphs ? ToMessageSeverity(Settings.CheckMaintainabilityMetrics) : EMessageSeverity::Info,
-			FText::Format(
-				INVTEXT("Number of graphs: {0} (max per BP: {1})"),
-				FText::AsNumber(NumBlueprintGraphs),
-				FText::AsNumber(Settings.MaxGraphsPerBlueprint))));
+		DiagnosticFunction(FDiagnostic{
+			EDiagnosticRule::GraphCount,
+			TooManyGraphs ? FailureSeverity : EMessageSeverity::Info,
+			nullptr,
+			{NumBlueprintGraphs, Settings.MaxGraphsPerBlueprint}});
 	}
 
-	TArray<TSharedPtr<FTokenizedMessage>> MetricMessages;
-
+	TArray<UEdGraph*> BlueprintGraphs;
+	BlueprintGraphs.Reserve(Graphs.Num());
 	for (auto* Graph : Graphs)
 	{
-		if (Graph == nullptr || OUU::BlueprintValidation::IsBlueprintGraph(*Graph) == false)
+		if (Graph && OUU::BlueprintValidation::IsBlueprintGraph(*Graph))
 		{
-			continue;
+			BlueprintGraphs.Add(Graph);
 		}
+	}
+
+	// Metrics of unchanged graphs are reused from previous validations (e.g. compile before save)
+	TArray<OUU::BlueprintValidation::FGraphMetrics> AllGraphMetrics;
+	OUU::BlueprintValidation::FGraphAnalysisCache::Get().GetOrComputeMetrics(BlueprintGraphs, OUT AllGraphMetrics);
+
+	TArray<FDiagnostic> MetricDiagnostics;
+
+	// Diagnostics are created in graph order, so the output is deterministic independent of the task scheduling of
+	// the metric computation.
+	for (int32 GraphIdx = 0; GraphIdx < BlueprintGraphs.Num(); ++GraphIdx)
+	{
+		auto* Graph = BlueprintGraphs[GraphIdx];
+		const auto& Metrics = AllGraphMetrics[GraphIdx];
 
 		AnyGraphRuleFailed = false;
 
 		// For display purposes: round all values to integers
 
-		const double GraphComplexityDouble = OUU::BlueprintValidation::ComputeCyclomaticGraphComplexity(*Graph);
+		const double GraphComplexityDouble = Settings.CyclomaticComplexityMode == EOUUCyclomaticComplexityMode::McCabe
+			? Metrics.McCabeCyclomaticComplexity
+			: Metrics.CyclomaticComplexity;
 		const int32 GraphComplexity = FMath::RoundToInt(GraphComplexityDouble);
-		const auto Halstead = OUU::BlueprintValidation::ComputeHalsteadGraphComplexity(*Graph);
+		const auto& Halstead = Metrics.Halstead;
 		const int32 HalsteadVolume = FMath::RoundToInt(Halstead.Volume);
-		const int32 LinesOfCode = OUU::BlueprintValidation::CountBlueprintLinesOfCode(*Graph);
+		const int32 LinesOfCode = Metrics.LinesOfCode;
 
 		const int32 MaintainabilityIndex =
 			FMath::RoundToInt(OUU::BlueprintValidation::ComputeMicrosoftMaintainabilityIndex(
@@ -106,98 +133,73 @@ void UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(
 				GraphComplexityDouble,
 				LinesOfCode));
 
-		const int32 CommentCount = OUU::BlueprintValidation::CountGraphComments(*Graph);
-		const int32 NodeCount = Graph->Nodes.Num();
+		const int32 CommentCount = Metrics.CommentCount;
+		const int32 NodeCount = Metrics.NodeCount;
 		const int32 CommentPercentage = FMath::RoundToInt(
 			CommentCount > 0 ? (static_cast<double>(CommentCount) / static_cast<double>(NodeCount)) * 100.0 : 0.0);
 
-		ConditionallyAddMessage(
+		ConditionallyAddDiagnostic(
 			MaintainabilityIndex < Settings.MinGraphMaintainabilityIndex,
 			*Graph,
-			FText::Format(
-				INVTEXT("Maintainability index: {0} (min per graph: {1})"),
-				FText::AsNumber(MaintainabilityIndex),
-				FText::AsNumber(Settings.MinGraphMaintainabilityIndex)));
+			EDiagnosticRule::MaintainabilityIndex,
+			{MaintainabilityIndex},
+			Settings.MinGraphMaintainabilityIndex);
 
-		ConditionallyAddMessage(
+		ConditionallyAddDiagnostic(
 			GraphComplexity > Settings.MaxCyclomaticComplexityPerGraph,
 			*Graph,
-			FText::Format(
-				INVTEXT("Cyclomatic Complexity: {0} (max per graph: {1})"),
-				FText::AsNumber(GraphComplexity),
-				FText::AsNumber(Settings.MaxCyclomaticComplexityPerGraph)));
+			EDiagnosticRule::CyclomaticComplexity,
+			{GraphComplexity, Settings.MaxCyclomaticComplexityPerGraph});
 
-		ConditionallyAddMessage(
+		ConditionallyAddDiagnostic(
 			Halstead.Volume > Settings.MaxHalsteadVolumePerGraph,
 			*Graph,
-			FText::Format(
-				INVTEXT("Halstead volume: {0} (max per graph: {1})"),
-				FText::AsNumber(HalsteadVolume),
-				FText::AsNumber(Settings.MaxHalsteadVolumePerGraph)));
+			EDiagnosticRule::HalsteadVolume,
+			{HalsteadVolume, Settings.MaxHalsteadVolumePerGraph});
 
-		ConditionallyAddMessage(
+		ConditionallyAddDiagnostic(
 			NodeCount > Settings.MaxNodeCountPerGraph,
 			*Graph,
-			FText::Format(
-				INVTEXT("Node count: {0} (max per graph: {1})"),
-				FText::AsNumber(NodeCount),
-				FText::AsNumber(Settings.MaxNodeCountPerGraph)));
+			EDiagnosticRule::NodeCount,
+			{NodeCount, Settings.MaxNodeCountPerGraph});
 
-		ConditionallyAddMessage(
+		ConditionallyAddDiagnostic(
 			NodeCount > Settings.MinNumberOfNodesToConsiderComments
 				&& CommentPercentage < Settings.MinCommentPercentagePerGraph,
 			*Graph,
-			FText::Format(
-				INVTEXT("Comment percentage: {0} (min per graph: {1}; only if more than {2} nodes)"),
-				FText::AsNumber(CommentPercentage),
-				FText::AsNumber(Settings.MinCommentPercentagePerGraph),
-				FText::AsNumber(Settings.MinNumberOfNodesToConsiderComments)));
+			EDiagnosticRule::CommentPercentage,
+			{CommentPercentage, Settings.MinNumberOfNodesToConsiderComments},
+			Settings.MinCommentPercentagePerGraph);
 
 		if (LogMetrics || AnyGraphRuleFailed)
 		{
-			auto MetricMessage = MakeGraphMessage(
+			const FDiagnostic MetricDiagnostic{
+				EDiagnosticRule::GraphMetrics,
 				EMessageSeverity::Info,
-				*Graph,
-				FText::Format(
-					INVTEXT("Maintainability Index: {0}; Cyclomatic Complexity: {1}; Halstead Volume: {2}; "
-							"Node Count: {3}; Comment %: {4}"),
-					FText::AsNumber(MaintainabilityIndex),
-					FText::AsNumber(GraphComplexity),
-					FText::AsNumber(HalsteadVolume),
-					FText::AsNumber(NodeCount),
-					FText::AsNumber(CommentPercentage)));
-
-			FString MessageURL = Settings.MaintainabilityDocumentationURL;
-			if (MessageURL.IsEmpty())
-			{
-				auto& PluginManager = IPluginManager::Get();
-				if (auto PluginPtr = PluginManager.FindPlugin(TEXT("OUUBlueprintValidation")))
-				{
-					MessageURL = FString::Printf(
-						TEXT("file:///%s/README.md"),
-						*FPaths::ConvertRelativePathToFull(PluginPtr->GetBaseDir()));
-				}
-			}
-			if (MessageURL.IsEmpty() == false)
-			{
-				MetricMessage->AddToken(FURLToken::Create(MessageURL, INVTEXT("HELP")));
-			}
+				Graph,
+				{MaintainabilityIndex,
+				 GraphComplexity,
+				 HalsteadVolume,
+				 NodeCount,
+				 CommentPercentage,
+				 FMath::RoundToInt(Metrics.CyclomaticComplexity),
+				 FMath::RoundToInt(Metrics.McCabeCyclomaticComplexity)}};
 			if (AnyGraphRuleFailed)
 			{
-				MessageFunction(MetricMessage);
+				DiagnosticFunction(MetricDiagnostic);
 			}
 			else
 			{
-				MetricMessages.Add(MetricMessage);
+				MetricDiagnostics.Add(MetricDiagnostic);
 			}
 		}
 	}
 
 	if (LogMetrics)
 	{
-		for (auto& Message : MetricMessages)
+		for (auto& Diagnostic : MetricDiagnostics)
 		{
-			MessageFunction(Message.ToSharedRef());
+			DiagnosticFunction(Diagnostic);
 		}
 	}
 }
@@ -0,0 +1,99 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintMetricsDerivedData.h"
+
+#include "DerivedDataCacheInterface.h"
+#include "Interfaces/IPluginManager.h"
+#include "OUUBlueprintGraphSnapshot.h"
+#include "OUUBlueprintValidationStats.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace OUU::BlueprintValidation
+{
+	static const TCHAR* MetricsDerivedDataPrefix = TEXT("OUUBPMETRICS");
+
+	static void SerializeMetrics(FArchive& Ar, FGraphMetrics& Metrics)
+	{
+		Ar << Metrics.CyclomaticComplexity;
+		Ar << Metrics.McCabeCyclomaticComplexity;
+		Ar << Metrics.Halstead.Vocabulary;
+		Ar << Metrics.Halstead.Length;
+		Ar << Metrics.Halstead.Effort;
+		Ar << Metrics.Halstead.Difficulty;
+		Ar << Metrics.Halstead.Volume;
+		Ar << Metrics.LinesOfCode;
+		Ar << Metrics.CommentCount;
+		Ar << Metrics.NodeCount;
+	}
+
+	static const FString& GetMetricsDerivedDataVersion()
+	{
+		static const FString Version = []() -> FString {
+			FString PluginVersion = TEXT("Unknown");
+			if (auto Plugin = IPluginManager::Get().FindPlugin(TEXT("OUUBlueprintValidation")))
+			{
+				PluginVersion = Plugin->GetDescriptor().VersionName;
+			}
+
+			// The maintainability index is not cached, but we still include its constants, so any change to the
+			// formulas reliably invalidates the cache.
+			using namespace MetricConstants;
+			return FString::Printf(
+				TEXT("%s_%d_%g_%g_%g_%g_%g"),
+				*PluginVersion,
+				GraphMetricsVersion,
+				PureNodesPerLineOfCode,
+				MaintainabilityIndexBase,
+				MaintainabilityIndexHalsteadVolumeFactor,
+				MaintainabilityIndexCyclomaticComplexityFactor,
+				MaintainabilityIndexLinesOfCodeFactor);
+		}();
+		return Version;
+	}
+
+	FString GetMetricsDerivedDataKey(const FGraphSnapshot& Snapshot)
+	{
+		return FDerivedDataCacheInterface::BuildCacheKey(
+			MetricsDerivedDataPrefix,
+			*GetMetricsDerivedDataVersion(),
+			*LexToString(HashGraphSnapshot(Snapshot)));
+	}
+
+	uint32 RequestMetricsFromDerivedDataCache(const FString& Key)
+	{
+		return GetDerivedDataCacheRef().GetAsynchronous(*Key, TEXT("OUUBlueprintValidation Graph Metrics"));
+	}
+
+	TOptional<FGraphMetrics> WaitForMetricsFromDerivedDataCache(uint32 Handle)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_DerivedDataCacheGet);
+		auto& DerivedDataCache = GetDerivedDataCacheRef();
+		DerivedDataCache.WaitAsynchronousCompletion(Handle);
+		TArray<uint8> Data;
+		if (DerivedDataCache.GetAsynchronousResults(Handle, OUT Data) == false)
+		{
+			return {};
+		}
+
+		FMemoryReader Reader(Data);
+		FGraphMetrics Metrics;
+		SerializeMetrics(Reader, Metrics);
+		if (Reader.IsError())
+		{
+			return {};
+		}
+		INC_DWORD_STAT(STAT_OUUBPV_DerivedDataCacheHits);
+		return Metrics;
+	}
+
+	void PutMetricsToDerivedDataCache(const FString& Key, const FGraphMetrics& Metrics)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_DerivedDataCachePut);
+		TArray<uint8> Data;
+		FMemoryWriter Writer(Data);
+		FGraphMetrics MetricsCopy = Metrics;
+		SerializeMetrics(Writer, MetricsCopy);
+		GetDerivedDataCacheRef().Put(*Key, Data, TEXT("OUUBlueprintValidation Graph Metrics"));
+	}
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,29 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "OUUBlueprintComplexity.h"
+
+namespace OUU::BlueprintValidation
+{
+	struct FGraphSnapshot;
+
+	// Persistent cache for graph metrics in the derived data cache, so metrics of graphs that did not change are shared
+	// between editor sessions and machines (if a shared DDC is configured).
+	// Keys are built from the hash of the graph snapshot, so they change whenever anything the metrics are computed
+	// from changes, including pins and purity of nodes that are defined in C++ or other assets (e.g. macro libraries).
+	// They also include the plugin version, GraphMetricsVersion and the metric formula constants.
+	FString GetMetricsDerivedDataKey(const FGraphSnapshot& Snapshot);
+
+	// Start looking up the metrics of a key without waiting for the result.
+	// Every returned handle must be passed to WaitForMetricsFromDerivedDataCache() exactly once.
+	uint32 RequestMetricsFromDerivedDataCache(const FString& Key);
+
+	// Wait for a request issued by RequestMetricsFromDerivedDataCache(). Safe to call from any thread.
+	// @returns unset metrics if the key was not found.
+	TOptional<FGraphMetrics> WaitForMetricsFromDerivedDataCache(uint32 Handle);
+
+	void PutMetricsToDerivedDataCache(const FString& Key, const FGraphMetrics& Metrics);
+} // namespace OUU::BlueprintValidation
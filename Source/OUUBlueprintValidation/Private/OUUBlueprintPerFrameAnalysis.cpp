@@ -0,0 +1,335 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintPerFrameAnalysis.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Composite.h"
+#include "K2Node_CreateDelegate.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_FormatText.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_MacroInstance.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet/KismetTextLibrary.h"
+#include "OUUBlueprintValidationRules.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+#include "WidgetBlueprint.h"
+
+namespace OUU::BlueprintValidation
+{
+	static UEdGraphNode* FindTunnelEntryNode(const UEdGraph& Graph)
+	{
+		for (UEdGraphNode* Node : Graph.Nodes)
+		{
+			if (Node && Node->IsA<UK2Node_Tunnel>() && IsBlueprintEntryNode(*Node))
+			{
+				return Node;
+			}
+		}
+		return nullptr;
+	}
+
+	// Function entry or event of the blueprint with the given name
+	static UEdGraphNode* FindLocalFunctionEntry(const UBlueprint& Blueprint, FName FunctionName)
+	{
+		if (FunctionName.IsNone())
+		{
+			return nullptr;
+		}
+
+		for (UEdGraph* Graph : Blueprint.FunctionGraphs)
+		{
+			if (Graph && Graph->GetFName() == FunctionName)
+			{
+				for (UEdGraphNode* Node : Graph->Nodes)
+				{
+					if (Node && Node->IsA<UK2Node_FunctionEntry>())
+					{
+						return Node;
+					}
+				}
+			}
+		}
+		for (UEdGraph* Graph : Blueprint.UbergraphPages)
+		{
+			if (Graph == nullptr)
+			{
+				continue;
+			}
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				auto* EventNode = Cast<UK2Node_Event>(Node);
+				if (EventNode && EventNode->GetFunctionName() == FunctionName)
+				{
+					return EventNode;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	class FPerFrameReachability
+	{
+	public:
+		FPerFrameReachability(const UBlueprint& InBlueprint, TArray<FPerFrameNode>& InReachedNodes) :
+			Blueprint(InBlueprint), ReachedNodes(InReachedNodes)
+		{
+		}
+
+		void Run()
+		{
+			TArray<UEdGraph*> AllGraphs;
+			Blueprint.GetAllGraphs(OUT AllGraphs);
+			for (auto* Graph : AllGraphs)
+			{
+				if (Graph == nullptr)
+				{
+					continue;
+				}
+				for (UEdGraphNode* Node : Graph->Nodes)
+				{
+					if (Node)
+					{
+						AddPerFrameEntryPoints(*Node);
+					}
+				}
+			}
+
+			if (auto* WidgetBlueprint = Cast<UWidgetBlueprint>(&Blueprint))
+			{
+				// Property bindings are evaluated every frame
+				for (auto& Binding : WidgetBlueprint->Bindings)
+				{
+					if (auto* BoundFunctionEntry = FindLocalFunctionEntry(Blueprint, Binding.FunctionName))
+					{
+						Reach(*BoundFunctionEntry, *BoundFunctionEntry, nullptr);
+					}
+				}
+			}
+
+			while (Worklist.Num() > 0)
+			{
+				const auto Entry = Worklist.Pop(EAllowShrinking::No);
+				Visit(*Entry.Node, *Entry.PerFrameEntry, Entry.OuterMacroInstance);
+			}
+		}
+
+	private:
+		void AddPerFrameEntryPoints(UEdGraphNode& Node)
+		{
+			auto& Settings = UOUUBlueprintValidationSettings::Get();
+			if (auto* EventNode = Cast<UK2Node_Event>(&Node))
+			{
+				if (EventNode->IsA<UK2Node_CustomEvent>() == false
+					&& Settings.PerFrameEventNames.Contains(EventNode->GetFunctionName()))
+				{
+					Reach(*EventNode, *EventNode, nullptr);
+				}
+				return;
+			}
+
+			// Overridden functions, e.g. OnPaint
+			if (Node.IsA<UK2Node_FunctionEntry>())
+			{
+				const auto* Graph = Node.GetGraph();
+				if (Graph && Settings.PerFrameEventNames.Contains(Graph->GetFName()))
+				{
+					Reach(Node, Node, nullptr);
+				}
+				return;
+			}
+
+			auto* CallNode = Cast<UK2Node_CallFunction>(&Node);
+			const auto* Function = CallNode ? CallNode->GetTargetFunction() : nullptr;
+			if (Function == nullptr || Function->GetOwnerClass() != UKismetSystemLibrary::StaticClass())
+			{
+				return;
+			}
+
+			const bool IsSetTimerByName =
+				Function->GetFName() == GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, K2_SetTimer);
+			const bool IsSetTimerByDelegate =
+				Function->GetFName() == GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, K2_SetTimerDelegate);
+			if (IsSetTimerByName == false && IsSetTimerByDelegate == false)
+			{
+				return;
+			}
+
+			// Timers with a dynamic looping flag are assumed to be looping
+			const auto* LoopingPin = CallNode->FindPin(TEXT("bLooping"), EGPD_Input);
+			const bool IsLooping = LoopingPin
+				&& (LoopingPin->LinkedTo.Num() > 0 || LoopingPin->GetDefaultAsString().ToBool());
+			if (IsLooping == false)
+			{
+				return;
+			}
+
+			UEdGraphNode* TimerFunctionEntry = nullptr;
+			if (IsSetTimerByName)
+			{
+				const auto* FunctionNamePin = CallNode->FindPin(TEXT("FunctionName"), EGPD_Input);
+				if (FunctionNamePin && FunctionNamePin->LinkedTo.IsEmpty())
+				{
+					TimerFunctionEntry = FindLocalFunctionEntry(Blueprint, FName(*FunctionNamePin->DefaultValue));
+				}
+			}
+			else if (const auto* DelegatePin = CallNode->FindPin(TEXT("Delegate"), EGPD_Input))
+			{
+				for (const auto* LinkedPin : DelegatePin->LinkedTo)
+				{
+					auto* DelegateNode = LinkedPin->GetOwningNodeUnchecked();
+					if (auto* CreateDelegateNode = Cast<UK2Node_CreateDelegate>(DelegateNode))
+					{
+						TimerFunctionEntry = FindLocalFunctionEntry(Blueprint, CreateDelegateNode->GetFunctionName());
+					}
+					else if (DelegateNode && DelegateNode->IsA<UK2Node_Event>())
+					{
+						TimerFunctionEntry = DelegateNode;
+					}
+				}
+			}
+
+			if (TimerFunctionEntry)
+			{
+				Reach(*TimerFunctionEntry, *CallNode, nullptr);
+			}
+		}
+
+		void Reach(const UEdGraphNode& Node, const UEdGraphNode& PerFrameEntry, const UEdGraphNode* OuterMacroInstance)
+		{
+			bool AlreadyReached = false;
+			VisitedNodes.Add({&Node, OuterMacroInstance}, &AlreadyReached);
+			if (AlreadyReached == false)
+			{
+				ReachedNodes.Add({&Node, &PerFrameEntry, OuterMacroInstance});
+				Worklist.Add({&Node, &PerFrameEntry, OuterMacroInstance});
+			}
+		}
+
+		void Visit(const UEdGraphNode& Node, const UEdGraphNode& PerFrameEntry, const UEdGraphNode* OuterMacroInstance)
+		{
+			for (auto* Pin : Node.Pins)
+			{
+				if (Pin == nullptr)
+				{
+					continue;
+				}
+
+				const bool IsExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+				// Follow the exec flow and the pure nodes that are evaluated for the inputs of this node
+				if (IsExecPin != (Pin->Direction == EGPD_Output))
+				{
+					continue;
+				}
+				for (const auto* LinkedPin : Pin->LinkedTo)
+				{
+					auto* LinkedNode = LinkedPin->GetOwningNodeUnchecked();
+					auto* LinkedK2Node = Cast<UK2Node>(LinkedNode);
+					if (LinkedNode && (IsExecPin || (LinkedK2Node && LinkedK2Node->IsNodePure())))
+					{
+						Reach(*LinkedNode, PerFrameEntry, OuterMacroInstance);
+					}
+				}
+			}
+
+			// Subgraphs are entered via their entry tunnel. Their exits are not followed, because the outputs of the
+			// composite or macro node are already followed above.
+			UEdGraph* Subgraph = nullptr;
+			const UEdGraphNode* SubgraphOuterMacroInstance = OuterMacroInstance;
+			if (auto* CompositeNode = Cast<UK2Node_Composite>(&Node))
+			{
+				Subgraph = CompositeNode->BoundGraph;
+			}
+			else if (auto* MacroNode = Cast<UK2Node_MacroInstance>(&Node))
+			{
+				Subgraph = MacroNode->GetMacroGraph();
+				// Nodes of macro libraries are shared by all blueprints using them, so everything found in there is
+				// attributed to the outermost macro instance of this blueprint instead.
+				if (OuterMacroInstance == nullptr && Subgraph && Subgraph->GetTypedOuter<UBlueprint>() != &Blueprint)
+				{
+					SubgraphOuterMacroInstance = MacroNode;
+				}
+			}
+			if (auto* SubgraphEntry = Subgraph ? FindTunnelEntryNode(*Subgraph) : nullptr)
+			{
+				Reach(*SubgraphEntry, PerFrameEntry, SubgraphOuterMacroInstance);
+			}
+
+			// Functions and custom events of this blueprint
+			if (auto* CallNode = Cast<UK2Node_CallFunction>(&Node))
+			{
+				const auto* Function = CallNode->GetTargetFunction();
+				const auto* OwnerClass = Function ? Function->GetOwnerClass() : nullptr;
+				if (OwnerClass && OwnerClass->ClassGeneratedBy == &Blueprint)
+				{
+					if (auto* FunctionEntry = FindLocalFunctionEntry(Blueprint, Function->GetFName()))
+					{
+						Reach(*FunctionEntry, PerFrameEntry, nullptr);
+					}
+				}
+			}
+		}
+
+		const UBlueprint& Blueprint;
+		TArray<FPerFrameNode>& ReachedNodes;
+		// Node and outer macro instance of all reached nodes
+		TSet<TPair<const UEdGraphNode*, const UEdGraphNode*>> VisitedNodes;
+		TArray<FPerFrameNode> Worklist;
+	};
+
+	void FindPerFrameNodes(const UBlueprint& Blueprint, TArray<FPerFrameNode>& OutReachedNodes)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_FindPerFrameNodes);
+		FPerFrameReachability(Blueprint, OutReachedNodes).Run();
+	}
+
+	void FindDisallowedPerFrameCalls(const UBlueprint& Blueprint, TArray<FPerFrameCallFinding>& OutFindings)
+	{
+		auto& Rules = FCompiledValidationRules::Get();
+		if (Rules.HasDisallowedPerFrameFunctions() == false)
+		{
+			return;
+		}
+
+		TArray<FPerFrameNode> PerFrameNodes;
+		FindPerFrameNodes(Blueprint, OUT PerFrameNodes);
+
+		// Format text nodes are expanded to a call of the text library during compilation
+		static const UFunction* FormatTextFunction = UKismetTextLibrary::StaticClass()->FindFunctionByName(
+			GET_FUNCTION_NAME_CHECKED(UKismetTextLibrary, Format));
+
+		// The same macro instance may contain multiple calls of the same function
+		TSet<TPair<const UEdGraphNode*, const UFunction*>> ReportedCalls;
+		for (auto& Entry : PerFrameNodes)
+		{
+			const UFunction* Function = nullptr;
+			if (auto* CallNode = Cast<UK2Node_CallFunction>(Entry.Node))
+			{
+				Function = CallNode->GetTargetFunction();
+			}
+			else if (Entry.Node->IsA<UK2Node_FormatText>())
+			{
+				Function = FormatTextFunction;
+			}
+
+			const FString* Reason = Function ? Rules.FindDisallowedPerFrameFunctionReason(*Function) : nullptr;
+			if (Reason == nullptr)
+			{
+				continue;
+			}
+
+			const UEdGraphNode* BlueprintNode = Entry.GetBlueprintNode();
+			bool AlreadyReported = false;
+			ReportedCalls.Add({BlueprintNode, Function}, &AlreadyReported);
+			if (AlreadyReported == false)
+			{
+				OutFindings.Add({const_cast<UEdGraphNode*>(BlueprintNode), Entry.PerFrameEntry, *Reason});
+			}
+		}
+	}
+} // namespace OUU::BlueprintValidation
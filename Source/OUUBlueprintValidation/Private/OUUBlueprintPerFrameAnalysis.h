@@ -0,0 +1,46 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraphNode;
+
+namespace OUU::BlueprintValidation
+{
+	struct FPerFrameNode
+	{
+		const UEdGraphNode* Node = nullptr;
+		// Per-frame entry point via which the node is reached first
+		const UEdGraphNode* PerFrameEntry = nullptr;
+		// Outermost macro instance node of the blueprint if the node is part of a macro graph of another asset (e.g.
+		// StandardMacros). Nullptr for nodes of the blueprint itself.
+		const UEdGraphNode* OuterMacroInstance = nullptr;
+
+		// Node of the blueprint that represents this node in diagnostics
+		const UEdGraphNode* GetBlueprintNode() const { return OuterMacroInstance ? OuterMacroInstance : Node; }
+	};
+
+	// Collect all nodes of a blueprint that are executed every frame.
+	// Per-frame entry points are the per-frame events and function overrides from the project settings (e.g. Event
+	// Tick), events and functions that are bound to looping timers and functions bound to UMG property bindings.
+	// The exec flow is followed into collapsed graphs, macros, local functions and local custom events. Pure nodes
+	// are reached via the inputs of reached nodes.
+	// Nodes of macro graphs of other assets are reached once per macro instance node of the blueprint.
+	void FindPerFrameNodes(const UBlueprint& Blueprint, TArray<FPerFrameNode>& OutReachedNodes);
+
+	struct FPerFrameCallFinding
+	{
+		// Node of the blueprint: The call itself or the macro instance node containing it
+		TWeakObjectPtr<UEdGraphNode> Node;
+		// Event, timer or bound function that makes the node run every frame
+		TWeakObjectPtr<const UEdGraphNode> PerFrameEntry;
+		// Reason from the project settings
+		FString Reason;
+	};
+
+	// Find calls of functions that are disallowed in per-frame code according to the project settings.
+	// Calls in macro graphs of other assets are reported on the macro instance nodes of the blueprint.
+	void FindDisallowedPerFrameCalls(const UBlueprint& Blueprint, TArray<FPerFrameCallFinding>& OutFindings);
+} // namespace OUU::BlueprintValidation
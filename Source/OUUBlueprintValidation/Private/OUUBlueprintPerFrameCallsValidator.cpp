@@ -0,0 +1,74 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintPerFrameCallsValidator.h"
+
+#include "Misc/DataValidation.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintPerFrameAnalysis.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+
+bool UOUUBlueprintPerFrameCallsValidator::CanValidateAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& InContext) const
+{
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	return IsValid(Cast<UBlueprint>(InAsset))
+		&& Settings.CheckPerFrameFunctions != EOUUBlueprintValidationSeverity::DoNotValidate
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
+}
+
+EDataValidationResult UOUUBlueprintPerFrameCallsValidator::ValidateLoadedAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& Context)
+{
+	const auto& Blueprint = *CastChecked<UBlueprint>(InAsset);
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	ValidatePerFrameCalls(Blueprint, [&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+		Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+		if (Diagnostic.Severity != EMessageSeverity::Info)
+		{
+			Result = EDataValidationResult::Invalid;
+		}
+	});
+	return Result;
+}
+
+void UOUUBlueprintPerFrameCallsValidator::ValidatePerFrameCalls(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction)
+{
+	using namespace OUU::BlueprintValidation;
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidatePerFrameCalls);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	FScopedBlueprintValidationTimer Timer(Blueprint);
+
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	if (Settings.CheckPerFrameFunctions == EOUUBlueprintValidationSeverity::DoNotValidate)
+	{
+		return;
+	}
+
+	// Reachability depends on all graphs of the blueprint, so unlike the per graph analyses this is not cached
+	TArray<FPerFrameCallFinding> Findings;
+	FindDisallowedPerFrameCalls(Blueprint, OUT Findings);
+
+	const auto Severity = ToMessageSeverity(Settings.CheckPerFrameFunctions);
+	for (auto& Finding : Findings)
+	{
+		auto* Node = Finding.Node.Get();
+		const auto* PerFrameEntry = Finding.PerFrameEntry.Get();
+		if (Node == nullptr || PerFrameEntry == nullptr)
+		{
+			continue;
+		}
+
+		FDiagnostic Diagnostic{EDiagnosticRule::PerFrameCall, Severity, Node};
+		Diagnostic.RelatedObject = PerFrameEntry;
+		Diagnostic.Reason = Finding.Reason;
+		DiagnosticFunction(Diagnostic);
+	}
+}
@@ -0,0 +1,289 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintPureReevaluation.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_MacroInstance.h"
+#include "OUUBlueprintGraphSnapshot.h"
+#include "OUUBlueprintLoopAnalysis.h"
+#include "OUUBlueprintValidationRules.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+
+namespace OUU::BlueprintValidation
+{
+	static uint32 MultiplyEvaluationCounts(uint32 A, uint32 B)
+	{
+		return static_cast<uint32>(FMath::Min<uint64>(static_cast<uint64>(A) * B, MAX_uint32));
+	}
+
+	class FPureReevaluationAnalyzer
+	{
+	public:
+		FPureReevaluationAnalyzer() :
+			AssumedLoopIterations(
+				static_cast<uint32>(FMath::Max(1, UOUUBlueprintValidationSettings::Get().AssumedLoopIterations)))
+		{
+		}
+
+		void FindExpensivePureCalls(UEdGraph& Graph, TArray<FPureReevaluationFinding>& OutFindings)
+		{
+			auto& Settings = UOUUBlueprintValidationSettings::Get();
+			auto& Rules = FCompiledValidationRules::Get();
+			const FGraphEvaluationCounts Counts = AnalyzeGraph(Graph);
+			for (int32 NodeIdx = 0; NodeIdx < Graph.Nodes.Num(); ++NodeIdx)
+			{
+				const uint32 EvaluationCount = Counts.PureExpressions.EvaluationCounts[NodeIdx];
+				if (EvaluationCount <= static_cast<uint32>(FMath::Max(0, Settings.MaxPureFunctionEvaluations)))
+				{
+					continue;
+				}
+
+				auto* CallNode = Cast<UK2Node_CallFunction>(Graph.Nodes[NodeIdx]);
+				const auto* Function = CallNode ? CallNode->GetTargetFunction() : nullptr;
+				if (Function && Rules.IsCheapPureFunction(*Function) == false)
+				{
+					OutFindings.Add({CallNode, EvaluationCount});
+				}
+			}
+		}
+
+	private:
+		struct FGraphEvaluationCounts
+		{
+			FGraphSnapshot Snapshot;
+			// Nodes that are executed on every iteration of a loop
+			TBitArray<> CycleNodes;
+			// Per node: Executions of impure nodes per execution of the graph
+			TArray<uint32> ExecutionCounts;
+			TArray<uint32> ParamPinEvaluationCounts;
+			FPureExpressionInfo PureExpressions;
+		};
+
+		struct FMacroEvaluationCounts
+		{
+			// Evaluations of the macro inputs per execution of the macro, by pin name
+			TMap<FName, uint32> InputEvaluationCounts;
+			// Exec outputs that are executed once per loop iteration, e.g. "Loop Body" of ForEachLoop
+			TSet<FName> LoopBodyOutputs;
+		};
+
+		FGraphEvaluationCounts AnalyzeGraph(UEdGraph& Graph)
+		{
+			FGraphEvaluationCounts Result;
+			Result.Snapshot = BuildGraphSnapshot(Graph);
+			Result.CycleNodes = FindExecCycleNodes(Result.Snapshot);
+			const auto& Snapshot = Result.Snapshot;
+			const int32 NumNodes = Snapshot.NumNodes();
+
+			// Propagate execution counts along the exec flow. Loop bodies of loop macros multiply the counts of all
+			// nodes that follow them. Counts only grow, so this terminates even for exec cycles (at the latest when
+			// the counts saturate).
+			TArray<uint32> PropagatedCounts;
+			PropagatedCounts.Init(1, NumNodes);
+			TArray<int32> Worklist;
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+			{
+				if (Snapshot.HasAnyFlags(NodeIdx, EGraphNodeFlags::Entry))
+				{
+					Worklist.Add(NodeIdx);
+				}
+			}
+			while (Worklist.Num() > 0)
+			{
+				const int32 NodeIdx = Worklist.Pop(EAllowShrinking::No);
+				const auto* MacroCounts = FindMacroEvaluationCounts(*Graph.Nodes[NodeIdx]);
+				const auto ExecOutTargetNodes = Snapshot.GetExecOutTargetNodes(NodeIdx);
+				int32 ExecOutIdx = 0;
+				for (const auto* Pin : Graph.Nodes[NodeIdx]->Pins)
+				{
+					if (Pin == nullptr || Pin->Direction != EGPD_Output
+						|| Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+					{
+						continue;
+					}
+
+					const int32 TargetNodeIdx = ExecOutTargetNodes[ExecOutIdx++];
+					if (TargetNodeIdx == INDEX_NONE)
+					{
+						continue;
+					}
+					const bool IsLoopBody = MacroCounts && MacroCounts->LoopBodyOutputs.Contains(Pin->PinName);
+					const uint32 TargetCount = MultiplyEvaluationCounts(
+						PropagatedCounts[NodeIdx],
+						IsLoopBody ? AssumedLoopIterations : 1);
+					if (TargetCount > PropagatedCounts[TargetNodeIdx])
+					{
+						PropagatedCounts[TargetNodeIdx] = TargetCount;
+						Worklist.Add(TargetNodeIdx);
+					}
+				}
+			}
+
+			Result.ExecutionCounts.SetNumUninitialized(NumNodes);
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+			{
+				Result.ExecutionCounts[NodeIdx] = MultiplyEvaluationCounts(
+					PropagatedCounts[NodeIdx],
+					Result.CycleNodes[NodeIdx] ? AssumedLoopIterations : 1);
+			}
+
+			// Same pin order as the parameter pins of the snapshot
+			Result.ParamPinEvaluationCounts.Reserve(Snapshot.NumParamPins());
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+			{
+				UEdGraphNode* Node = Graph.Nodes[NodeIdx];
+				if (Node == nullptr)
+				{
+					continue;
+				}
+
+				const auto* MacroCounts = FindMacroEvaluationCounts(*Node);
+				for (const auto* Pin : Node->Pins)
+				{
+					if (Pin == nullptr || Pin->Direction != EGPD_Input
+						|| Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+					{
+						continue;
+					}
+
+					// Macros may evaluate their inputs any number of times, e.g. the array of a ForEachLoop is
+					// evaluated on every iteration
+					const uint32* MacroInputCount =
+						MacroCounts ? MacroCounts->InputEvaluationCounts.Find(Pin->PinName) : nullptr;
+					Result.ParamPinEvaluationCounts.Add(MultiplyEvaluationCounts(
+						Result.ExecutionCounts[NodeIdx],
+						MacroInputCount ? *MacroInputCount : 1));
+				}
+			}
+
+			Result.PureExpressions = AnalyzePureExpressions(Snapshot, Result.ParamPinEvaluationCounts);
+			return Result;
+		}
+
+		const FMacroEvaluationCounts* FindMacroEvaluationCounts(UEdGraphNode& Node)
+		{
+			auto* MacroNode = Cast<UK2Node_MacroInstance>(&Node);
+			auto* MacroGraph = MacroNode ? MacroNode->GetMacroGraph() : nullptr;
+			if (MacroGraph == nullptr)
+			{
+				return nullptr;
+			}
+
+			if (const auto* ExistingCounts = MacroEvaluationCounts.Find(MacroGraph))
+			{
+				return ExistingCounts;
+			}
+
+			// Macros can't contain instances of themselves, but broken assets might. The placeholder also
+			// terminates the recursion for those.
+			MacroEvaluationCounts.Add(MacroGraph);
+			FMacroEvaluationCounts Counts = AnalyzeMacroGraph(*MacroGraph);
+			return &(MacroEvaluationCounts[MacroGraph] = MoveTemp(Counts));
+		}
+
+		FMacroEvaluationCounts AnalyzeMacroGraph(UEdGraph& MacroGraph)
+		{
+			FMacroEvaluationCounts Result;
+			const FGraphEvaluationCounts GraphCounts = AnalyzeGraph(MacroGraph);
+			const auto& Snapshot = GraphCounts.Snapshot;
+
+			TMap<const UEdGraphNode*, int32> NodeIndices;
+			for (int32 NodeIdx = 0; NodeIdx < MacroGraph.Nodes.Num(); ++NodeIdx)
+			{
+				NodeIndices.Add(MacroGraph.Nodes[NodeIdx], NodeIdx);
+			}
+
+			// Index of each linked input pin in the parameter pins of the snapshot
+			TMap<const UEdGraphPin*, int32> ParamPinIndices;
+			int32 ParamPinIdx = 0;
+			for (UEdGraphNode* Node : MacroGraph.Nodes)
+			{
+				if (Node == nullptr)
+				{
+					continue;
+				}
+				for (const auto* Pin : Node->Pins)
+				{
+					if (Pin && Pin->Direction == EGPD_Input && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+					{
+						ParamPinIndices.Add(Pin, ParamPinIdx++);
+					}
+				}
+			}
+
+			for (UEdGraphNode* Node : MacroGraph.Nodes)
+			{
+				auto* Tunnel = Cast<UK2Node_Tunnel>(Node);
+				if (Tunnel == nullptr || Tunnel->IsA<UK2Node_MacroInstance>())
+				{
+					continue;
+				}
+
+				for (const auto* Pin : Tunnel->Pins)
+				{
+					if (Pin == nullptr)
+					{
+						continue;
+					}
+					const bool IsExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+					if (Tunnel->bCanHaveOutputs && Pin->Direction == EGPD_Output && IsExecPin == false)
+					{
+						// Macro input: Sum of the evaluations of all nodes that read it
+						uint64 EvaluationCount = 0;
+						for (const auto* LinkedPin : Pin->LinkedTo)
+						{
+							const int32* ConsumerIdx = NodeIndices.Find(LinkedPin->GetOwningNodeUnchecked());
+							const int32* LinkedParamPinIdx = ParamPinIndices.Find(LinkedPin);
+							if (ConsumerIdx == nullptr || LinkedParamPinIdx == nullptr)
+							{
+								continue;
+							}
+							EvaluationCount += Snapshot.IsPureK2Node(*ConsumerIdx)
+								? GraphCounts.PureExpressions.EvaluationCounts[*ConsumerIdx]
+								: GraphCounts.ParamPinEvaluationCounts[*LinkedParamPinIdx];
+						}
+						Result.InputEvaluationCounts.Add(
+							Pin->PinName,
+							static_cast<uint32>(FMath::Min<uint64>(EvaluationCount, MAX_uint32)));
+					}
+					else if (Tunnel->bCanHaveInputs && Pin->Direction == EGPD_Input && IsExecPin)
+					{
+						// Macro exec output: Executed once per iteration if it's a loop body
+						for (const auto* LinkedPin : Pin->LinkedTo)
+						{
+							const int32* SourceIdx = NodeIndices.Find(LinkedPin->GetOwningNodeUnchecked());
+							if (SourceIdx && IsLoopBodyTrigger(Snapshot, GraphCounts.CycleNodes, *SourceIdx))
+							{
+								Result.LoopBodyOutputs.Add(Pin->PinName);
+							}
+						}
+					}
+				}
+			}
+			return Result;
+		}
+
+		uint32 AssumedLoopIterations = 1;
+		TMap<const UEdGraph*, FMacroEvaluationCounts> MacroEvaluationCounts;
+	};
+
+	void FindExpensivePureReevaluations(const UBlueprint& Blueprint, TArray<FPureReevaluationFinding>& OutFindings)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_AnalyzePureReevaluation);
+		FPureReevaluationAnalyzer Analyzer;
+		TArray<UEdGraph*> AllGraphs;
+		Blueprint.GetAllGraphs(OUT AllGraphs);
+		for (auto* Graph : AllGraphs)
+		{
+			if (Graph && IsBlueprintGraph(*Graph))
+			{
+				Analyzer.FindExpensivePureCalls(*Graph, OUT OutFindings);
+			}
+		}
+	}
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,24 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraphNode;
+
+namespace OUU::BlueprintValidation
+{
+	struct FPureReevaluationFinding
+	{
+		TWeakObjectPtr<UEdGraphNode> Node;
+		// Estimated evaluations of the pure node per execution of its graph
+		uint32 EvaluationCount = 0;
+	};
+
+	// Find pure function calls that are evaluated more often than the budget from the project settings.
+	// Pure nodes are evaluated again for every impure node that consumes them and on every loop iteration. Loops are
+	// detected in the exec flow of the graphs and in the macro graphs of loop macros (e.g. ForEachLoop), which are
+	// assumed to run AssumedLoopIterations times.
+	void FindExpensivePureReevaluations(const UBlueprint& Blueprint, TArray<FPureReevaluationFinding>& OutFindings);
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,74 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintPureReevaluationValidator.h"
+
+#include "Misc/DataValidation.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintPureReevaluation.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+
+bool UOUUBlueprintPureReevaluationValidator::CanValidateAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& InContext) const
+{
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	return IsValid(Cast<UBlueprint>(InAsset))
+		&& Settings.CheckPureReevaluation != EOUUBlueprintValidationSeverity::DoNotValidate
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
+}
+
+EDataValidationResult UOUUBlueprintPureReevaluationValidator::ValidateLoadedAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& Context)
+{
+	const auto& Blueprint = *CastChecked<UBlueprint>(InAsset);
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	ValidatePureReevaluation(Blueprint, [&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+		Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+		if (Diagnostic.Severity != EMessageSeverity::Info)
+		{
+			Result = EDataValidationResult::Invalid;
+		}
+	});
+	return Result;
+}
+
+void UOUUBlueprintPureReevaluationValidator::ValidatePureReevaluation(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction)
+{
+	using namespace OUU::BlueprintValidation;
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidatePureReevaluation);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	FScopedBlueprintValidationTimer Timer(Blueprint);
+
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	if (Settings.CheckPureReevaluation == EOUUBlueprintValidationSeverity::DoNotValidate)
+	{
+		return;
+	}
+
+	TArray<FPureReevaluationFinding> Findings;
+	FindExpensivePureReevaluations(Blueprint, OUT Findings);
+
+	const auto Severity = ToMessageSeverity(Settings.CheckPureReevaluation);
+	for (auto& Finding : Findings)
+	{
+		auto* Node = Finding.Node.Get();
+		if (Node == nullptr)
+		{
+			continue;
+		}
+
+		DiagnosticFunction(FDiagnostic{
+			EDiagnosticRule::PureReevaluation,
+			Severity,
+			Node,
+			{static_cast<int32>(FMath::Min<uint32>(Finding.EvaluationCount, MAX_int32)),
+			 Settings.MaxPureFunctionEvaluations}});
+	}
+}
@@ -0,0 +1,82 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintReferenceFootprint.h"
+
+#include "Algo/Reverse.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "OUUBlueprintValidationStats.h"
+
+namespace OUU::BlueprintValidation
+{
+	TArray<FName> FReferenceFootprint::GetReferenceChain(int32 PackageIdx) const
+	{
+		TArray<FName> Chain;
+		for (int32 ChainIdx = PackageIdx; ChainIdx != INDEX_NONE; ChainIdx = Packages[ChainIdx].ReferencerIdx)
+		{
+			Chain.Add(Packages[ChainIdx].PackageName);
+		}
+		Algo::Reverse(Chain);
+		return Chain;
+	}
+
+	static FTopLevelAssetPath FindMainAssetClassPath(const IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPackageName(PackageName, OUT Assets, true);
+		for (auto& AssetData : Assets)
+		{
+			if (AssetData.IsUAsset())
+			{
+				return AssetData.AssetClassPath;
+			}
+		}
+		return Assets.Num() > 0 ? Assets[0].AssetClassPath : FTopLevelAssetPath();
+	}
+
+	void ComputeReferenceFootprint(FName PackageName, FReferenceFootprint& OutFootprint)
+	{
+		OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ComputeReferenceFootprint);
+		OutFootprint = {};
+
+		auto& AssetRegistry = IAssetRegistry::GetChecked();
+		// Editor-only references (e.g. thumbnails, editor utility references) are not loaded in cooked builds
+		const UE::AssetRegistry::FDependencyQuery Query(
+			UE::AssetRegistry::EDependencyQuery::Hard | UE::AssetRegistry::EDependencyQuery::Game);
+
+		TSet<FName> VisitedPackages;
+		VisitedPackages.Add(PackageName);
+		TArray<FName> Dependencies;
+		// Breadth first, so the recorded referencers form the shortest reference chains
+		for (int32 ReferencerIdx = INDEX_NONE; ReferencerIdx < OutFootprint.Packages.Num(); ++ReferencerIdx)
+		{
+			const FName ReferencerName =
+				ReferencerIdx == INDEX_NONE ? PackageName : OutFootprint.Packages[ReferencerIdx].PackageName;
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(
+				ReferencerName,
+				OUT Dependencies,
+				UE::AssetRegistry::EDependencyCategory::Package,
+				Query);
+
+			for (FName Dependency : Dependencies)
+			{
+				bool AlreadyVisited = false;
+				VisitedPackages.Add(Dependency, &AlreadyVisited);
+				if (AlreadyVisited || FPackageName::IsScriptPackage(Dependency.ToString()))
+				{
+					continue;
+				}
+
+				const auto PackageData = AssetRegistry.GetAssetPackageDataCopy(Dependency);
+				auto& Package = OutFootprint.Packages.AddDefaulted_GetRef();
+				Package.PackageName = Dependency;
+				Package.AssetClassPath = FindMainAssetClassPath(AssetRegistry, Dependency);
+				Package.DiskSize = PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+				Package.ReferencerIdx = ReferencerIdx;
+				OutFootprint.TotalDiskSize += Package.DiskSize;
+			}
+		}
+	}
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,37 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/TopLevelAssetPath.h"
+
+namespace OUU::BlueprintValidation
+{
+	// A package that is loaded together with the root package, because it's (transitively) hard referenced
+	struct FReferencedPackage
+	{
+		FName PackageName;
+		// Class of the main asset of the package
+		FTopLevelAssetPath AssetClassPath;
+		int64 DiskSize = 0;
+		// Package that references this package on the shortest reference chain from the root package.
+		// INDEX_NONE for packages that are referenced by the root package directly.
+		int32 ReferencerIdx = INDEX_NONE;
+	};
+
+	struct FReferenceFootprint
+	{
+		// All hard referenced packages in breadth first order, excluding the root package itself
+		TArray<FReferencedPackage> Packages;
+		int64 TotalDiskSize = 0;
+
+		// Shortest chain of hard references from the root package to a referenced package, excluding the root package
+		TArray<FName> GetReferenceChain(int32 PackageIdx) const;
+	};
+
+	// Compute the transitive closure of the runtime hard references of a package from asset registry data.
+	// No packages are loaded, so this only reflects the references of the packages as they were last saved.
+	// Script packages are excluded, because native classes are always loaded anyway.
+	void ComputeReferenceFootprint(FName PackageName, FReferenceFootprint& OutFootprint);
+} // namespace OUU::BlueprintValidation
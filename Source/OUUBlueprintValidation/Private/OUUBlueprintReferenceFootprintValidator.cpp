@@ -0,0 +1,178 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintReferenceFootprintValidator.h"
+
+#include "Engine/Blueprint.h"
+#include "Misc/DataValidation.h"
+#include "OUUBlueprintReferenceFootprint.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+
+bool UOUUBlueprintReferenceFootprintValidator::CanValidateAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& InContext) const
+{
+	// Not covered by the validation summary in the asset registry tags, because the references are only gathered
+	// after the tags were written. Computing the footprint from the asset registry is cheap enough to always run.
+	return IsValid(Cast<UBlueprint>(InAsset))
+		&& UOUUBlueprintValidationSettings::Get().CheckReferenceFootprint
+		!= EOUUBlueprintValidationSeverity::DoNotValidate;
+}
+
+EDataValidationResult UOUUBlueprintReferenceFootprintValidator::ValidateLoadedAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& Context)
+{
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	ValidateReferenceFootprint(
+		InAsset->GetPackage()->GetFName(),
+		[&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+			Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+			if (Diagnostic.Severity != EMessageSeverity::Info)
+			{
+				Result = EDataValidationResult::Invalid;
+			}
+		},
+		UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+	return Result;
+}
+
+namespace OUU::BlueprintValidation
+{
+	// Checks the super class chain of the asset class, if the class is loaded. Unloaded (blueprint) asset classes
+	// are only matched exactly, so the check never loads anything.
+	static bool IsAssetClassChildOf(const FTopLevelAssetPath& AssetClassPath, const FTopLevelAssetPath& BaseClassPath)
+	{
+		if (AssetClassPath == BaseClassPath)
+		{
+			return true;
+		}
+		for (auto* Class = FindObject<UClass>(AssetClassPath); Class; Class = Class->GetSuperClass())
+		{
+			if (Class->GetClassPathName() == BaseClassPath)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static int64 MegabytesToBytes(int32 Megabytes) { return static_cast<int64>(Megabytes) * 1024 * 1024; }
+} // namespace OUU::BlueprintValidation
+
+void UOUUBlueprintReferenceFootprintValidator::ValidateReferenceFootprint(
+	FName PackageName,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+	bool LogFootprint)
+{
+	using namespace OUU::BlueprintValidation;
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidateReferenceFootprint);
+
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	if (Settings.CheckReferenceFootprint == EOUUBlueprintValidationSeverity::DoNotValidate)
+	{
+		return;
+	}
+
+	FReferenceFootprint Footprint;
+	ComputeReferenceFootprint(PackageName, OUT Footprint);
+
+	const auto FailureSeverity = ToMessageSeverity(Settings.CheckReferenceFootprint);
+	auto AddDiagnostic =
+		[&](EDiagnosticRule Rule, EMessageSeverity::Type Severity, std::initializer_list<int64> Values) {
+			FDiagnostic Diagnostic{Rule, Severity};
+			Diagnostic.PackageName = PackageName;
+			Diagnostic.SetValues(Values);
+			DiagnosticFunction(Diagnostic);
+		};
+	// Report how the heaviest packages that count towards a budget are referenced, so it's clear which reference to
+	// replace with a soft reference
+	auto AddHeaviestReferenceChains = [&](TFunctionRef<bool(const FReferencedPackage&)> Predicate) {
+		TArray<int32> PackageIndices;
+		for (int32 PackageIdx = 0; PackageIdx < Footprint.Packages.Num(); ++PackageIdx)
+		{
+			if (Predicate(Footprint.Packages[PackageIdx]))
+			{
+				PackageIndices.Add(PackageIdx);
+			}
+		}
+		PackageIndices.StableSort([&](int32 A, int32 B) {
+			return Footprint.Packages[A].DiskSize > Footprint.Packages[B].DiskSize;
+		});
+
+		const int32 NumChains = FMath::Min(PackageIndices.Num(), Settings.NumReportedReferenceChains);
+		for (int32 ChainIdx = 0; ChainIdx < NumChains; ++ChainIdx)
+		{
+			const int32 PackageIdx = PackageIndices[ChainIdx];
+			const TArray<FName> ReferenceChain = Footprint.GetReferenceChain(PackageIdx);
+			FDiagnostic Diagnostic{EDiagnosticRule::HeavyReference, EMessageSeverity::Info};
+			Diagnostic.PackageName = PackageName;
+			Diagnostic.SetValues({Footprint.Packages[PackageIdx].DiskSize});
+			Diagnostic.ReferenceChain = ReferenceChain;
+			DiagnosticFunction(Diagnostic);
+		}
+	};
+
+	const bool TooManyPackages = Footprint.Packages.Num() > Settings.MaxReferencedPackages;
+	const bool TooLarge = Footprint.TotalDiskSize > MegabytesToBytes(Settings.MaxReferencedSizeMB);
+	if (TooManyPackages)
+	{
+		AddDiagnostic(
+			EDiagnosticRule::ReferencedPackageCount,
+			FailureSeverity,
+			{Footprint.Packages.Num(), Settings.MaxReferencedPackages});
+	}
+	if (TooLarge)
+	{
+		AddDiagnostic(
+			EDiagnosticRule::ReferencedSize,
+			FailureSeverity,
+			{Footprint.TotalDiskSize, MegabytesToBytes(Settings.MaxReferencedSizeMB)});
+	}
+	if (TooManyPackages == false && TooLarge == false && LogFootprint)
+	{
+		AddDiagnostic(
+			EDiagnosticRule::ReferenceFootprint,
+			EMessageSeverity::Info,
+			{Footprint.Packages.Num(), Footprint.TotalDiskSize});
+	}
+	if (TooManyPackages || TooLarge || LogFootprint)
+	{
+		AddHeaviestReferenceChains([](const FReferencedPackage&) { return true; });
+	}
+
+	for (auto& Budget : Settings.MaxReferencedSizePerAssetClassMB)
+	{
+		const FTopLevelAssetPath BudgetClassPath = Budget.Key.ToSoftObjectPath().GetAssetPath();
+		if (BudgetClassPath.IsNull())
+		{
+			continue;
+		}
+
+		auto IsBudgetClass = [&](const FReferencedPackage& Package) {
+			return IsAssetClassChildOf(Package.AssetClassPath, BudgetClassPath);
+		};
+		int32 NumClassPackages = 0;
+		int64 ClassDiskSize = 0;
+		for (auto& Package : Footprint.Packages)
+		{
+			if (IsBudgetClass(Package))
+			{
+				NumClassPackages++;
+				ClassDiskSize += Package.DiskSize;
+			}
+		}
+
+		if (ClassDiskSize > MegabytesToBytes(Budget.Value))
+		{
+			FDiagnostic Diagnostic{EDiagnosticRule::ReferencedClassSize, FailureSeverity};
+			Diagnostic.PackageName = PackageName;
+			Diagnostic.RelatedName = BudgetClassPath.GetAssetName();
+			Diagnostic.SetValues({NumClassPackages, ClassDiskSize, MegabytesToBytes(Budget.Value)});
+			DiagnosticFunction(Diagnostic);
+			AddHeaviestReferenceChains(IsBudgetClass);
+		}
+	}
+}
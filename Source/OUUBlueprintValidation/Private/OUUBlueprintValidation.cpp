@@ -2,17 +2,42 @@
 
 #include "BlueprintCompilationManager.h"
 #include "Modules/ModuleManager.h"
+#include "OUUBlueprintAnalysisCache.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintAsyncValidation.h"
+#include "OUUBlueprintCompileProfiler.h"
+#include "OUUBlueprintLiveMetrics.h"
 #include "OUUBlueprintValidationCompilerExtension.h"
+#include "OUUBlueprintValidationRules.h"
 
 class FOUUBlueprintValidationModule : public IModuleInterface
 {
 public:
 	void StartupModule()
 	{
+		OUU::BlueprintValidation::FGraphAnalysisCache::Startup();
+		OUU::BlueprintValidation::FCompiledValidationRules::Startup();
+		OUU::BlueprintValidation::RegisterAssetRegistryTags();
+		OUU::BlueprintValidation::FAsyncMaintainabilityValidation::Startup();
+		OUU::BlueprintValidation::FLiveGraphMetrics::Startup();
+		OUU::BlueprintValidation::RegisterLiveMetricsToolbar();
+		OUU::BlueprintValidation::FBlueprintCompileProfiler::Startup();
+
 		FBlueprintCompilationManager::RegisterCompilerExtension(
 			UBlueprint::StaticClass(),
 			NewObject<UOUUBlueprintValidationCompilerExtension>());
 	}
+
+	void ShutdownModule()
+	{
+		OUU::BlueprintValidation::FBlueprintCompileProfiler::Shutdown();
+		OUU::BlueprintValidation::UnregisterLiveMetricsToolbar();
+		OUU::BlueprintValidation::FLiveGraphMetrics::Shutdown();
+		OUU::BlueprintValidation::FAsyncMaintainabilityValidation::Shutdown();
+		OUU::BlueprintValidation::UnregisterAssetRegistryTags();
+		OUU::BlueprintValidation::FCompiledValidationRules::Shutdown();
+		OUU::BlueprintValidation::FGraphAnalysisCache::Shutdown();
+	}
 };
 
 IMPLEMENT_MODULE(FOUUBlueprintValidationModule, OUUBlueprintValidation)
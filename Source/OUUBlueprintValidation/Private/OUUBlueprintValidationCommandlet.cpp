@@ -0,0 +1,635 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintValidationCommandlet.h"
+
+#include "Algo/Count.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintBytecodeCostValidator.h"
+#include "OUUBlueprintDisallowedNodesValidator.h"
+#include "OUUBlueprintInstanceFootprintValidator.h"
+#include "OUUBlueprintLoopNestingValidator.h"
+#include "OUUBlueprintMaintainabilityValidator.h"
+#include "OUUBlueprintPerFrameCallsValidator.h"
+#include "OUUBlueprintPureReevaluationValidator.h"
+#include "OUUBlueprintReferenceFootprintValidator.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintWidgetBindingsValidator.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectHash.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOUUBlueprintValidationCommandlet, Log, All);
+
+namespace OUU::BlueprintValidation
+{
+	struct FBlueprintReportMessage
+	{
+		EMessageSeverity::Type Severity = EMessageSeverity::Info;
+		FString Text;
+	};
+
+	struct FBlueprintReport
+	{
+		FString PackageName;
+		FString AssetName;
+		bool LoadFailed = false;
+		// Not loaded, because the asset registry tags show that the blueprint passes validation
+		bool Skipped = false;
+		double DurationSeconds = 0.0;
+		TArray<FBlueprintReportMessage> Messages;
+
+		bool HasFailures() const
+		{
+			return LoadFailed || Messages.ContainsByPredicate([](const FBlueprintReportMessage& Message) {
+				return Message.Severity != EMessageSeverity::Info;
+			});
+		}
+	};
+
+	static FString SeverityToString(EMessageSeverity::Type Severity)
+	{
+		switch (Severity)
+		{
+		case EMessageSeverity::Error: return TEXT("Error");
+		case EMessageSeverity::PerformanceWarning:
+		case EMessageSeverity::Warning: return TEXT("Warning");
+		default: return TEXT("Info");
+		}
+	}
+
+	static EMessageSeverity::Type SeverityFromString(const FString& Severity)
+	{
+		if (Severity == TEXT("Error"))
+		{
+			return EMessageSeverity::Error;
+		}
+		if (Severity == TEXT("Warning"))
+		{
+			return EMessageSeverity::Warning;
+		}
+		return EMessageSeverity::Info;
+	}
+
+	static FString EscapeXml(const FString& Text)
+	{
+		FString Result;
+		Result.Reserve(Text.Len());
+		for (const TCHAR Char : Text)
+		{
+			switch (Char)
+			{
+			case TEXT('&'): Result += TEXT("&amp;"); break;
+			case TEXT('<'): Result += TEXT("&lt;"); break;
+			case TEXT('>'): Result += TEXT("&gt;"); break;
+			case TEXT('"'): Result += TEXT("&quot;"); break;
+			case TEXT('\''): Result += TEXT("&apos;"); break;
+			default: Result.AppendChar(Char); break;
+			}
+		}
+		return Result;
+	}
+
+	static bool WriteJsonReport(const FString& FilePath, const TArray<FBlueprintReport>& Reports)
+	{
+		TArray<TSharedPtr<FJsonValue>> BlueprintValues;
+		for (auto& Report : Reports)
+		{
+			auto BlueprintObject = MakeShared<FJsonObject>();
+			BlueprintObject->SetStringField(TEXT("Package"), Report.PackageName);
+			BlueprintObject->SetStringField(TEXT("Asset"), Report.AssetName);
+			BlueprintObject->SetBoolField(TEXT("LoadFailed"), Report.LoadFailed);
+			BlueprintObject->SetBoolField(TEXT("Skipped"), Report.Skipped);
+			BlueprintObject->SetNumberField(TEXT("DurationSeconds"), Report.DurationSeconds);
+
+			TArray<TSharedPtr<FJsonValue>> MessageValues;
+			for (auto& Message : Report.Messages)
+			{
+				auto MessageObject = MakeShared<FJsonObject>();
+				MessageObject->SetStringField(TEXT("Severity"), SeverityToString(Message.Severity));
+				MessageObject->SetStringField(TEXT("Message"), Message.Text);
+				MessageValues.Add(MakeShared<FJsonValueObject>(MessageObject));
+			}
+			BlueprintObject->SetArrayField(TEXT("Messages"), MessageValues);
+			BlueprintValues.Add(MakeShared<FJsonValueObject>(BlueprintObject));
+		}
+
+		auto RootObject = MakeShared<FJsonObject>();
+		RootObject->SetNumberField(TEXT("NumBlueprints"), Reports.Num());
+		RootObject->SetNumberField(
+			TEXT("NumFailedBlueprints"),
+			Algo::CountIf(Reports, [](const FBlueprintReport& Report) { return Report.HasFailures(); }));
+		RootObject->SetArrayField(TEXT("Blueprints"), BlueprintValues);
+
+		FString JsonString;
+		const auto Writer = TJsonWriterFactory<>::Create(&JsonString);
+		return FJsonSerializer::Serialize(RootObject, Writer) && FFileHelper::SaveStringToFile(JsonString, *FilePath);
+	}
+
+	static bool ReadJsonReport(const FString& FilePath, TArray<FBlueprintReport>& OutReports)
+	{
+		FString JsonString;
+		if (FFileHelper::LoadFileToString(OUT JsonString, *FilePath) == false)
+		{
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> RootObject;
+		if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), OUT RootObject) == false
+			|| RootObject.IsValid() == false)
+		{
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* BlueprintValues = nullptr;
+		if (RootObject->TryGetArrayField(TEXT("Blueprints"), OUT BlueprintValues) == false)
+		{
+			return false;
+		}
+
+		for (auto& BlueprintValue : *BlueprintValues)
+		{
+			const auto BlueprintObject = BlueprintValue->AsObject();
+			if (BlueprintObject.IsValid() == false)
+			{
+				return false;
+			}
+
+			FBlueprintReport& Report = OutReports.AddDefaulted_GetRef();
+			Report.PackageName = BlueprintObject->GetStringField(TEXT("Package"));
+			Report.AssetName = BlueprintObject->GetStringField(TEXT("Asset"));
+			Report.LoadFailed = BlueprintObject->GetBoolField(TEXT("LoadFailed"));
+			BlueprintObject->TryGetBoolField(TEXT("Skipped"), OUT Report.Skipped);
+			Report.DurationSeconds = BlueprintObject->GetNumberField(TEXT("DurationSeconds"));
+			for (auto& MessageValue : BlueprintObject->GetArrayField(TEXT("Messages")))
+			{
+				const auto MessageObject = MessageValue->AsObject();
+				if (MessageObject.IsValid())
+				{
+					Report.Messages.Add(
+						{SeverityFromString(MessageObject->GetStringField(TEXT("Severity"))),
+						 MessageObject->GetStringField(TEXT("Message"))});
+				}
+			}
+		}
+		return true;
+	}
+
+	static bool WriteJUnitReport(const FString& FilePath, const TArray<FBlueprintReport>& Reports)
+	{
+		const int32 NumFailures =
+			Algo::CountIf(Reports, [](const FBlueprintReport& Report) { return Report.HasFailures(); });
+		double TotalDuration = 0.0;
+		for (auto& Report : Reports)
+		{
+			TotalDuration += Report.DurationSeconds;
+		}
+
+		FString Xml = TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+		Xml += FString::Printf(
+			TEXT("<testsuites>\n\t<testsuite name=\"OUUBlueprintValidation\" tests=\"%d\" failures=\"%d\" "
+				 "time=\"%.3f\">\n"),
+			Reports.Num(),
+			NumFailures,
+			TotalDuration);
+		for (auto& Report : Reports)
+		{
+			Xml += FString::Printf(
+				TEXT("\t\t<testcase classname=\"%s\" name=\"%s\" time=\"%.3f\">\n"),
+				*EscapeXml(Report.PackageName),
+				*EscapeXml(Report.AssetName),
+				Report.DurationSeconds);
+
+			if (Report.LoadFailed)
+			{
+				Xml += TEXT("\t\t\t<failure message=\"Failed to load blueprint\" type=\"Error\"/>\n");
+			}
+			if (Report.Skipped)
+			{
+				Xml += TEXT("\t\t\t<skipped message=\"Passed validation according to asset registry tags\"/>\n");
+			}
+
+			FString InfoText;
+			for (auto& Message : Report.Messages)
+			{
+				if (Message.Severity == EMessageSeverity::Info)
+				{
+					InfoText += Message.Text + TEXT("\n");
+					continue;
+				}
+				Xml += FString::Printf(
+					TEXT("\t\t\t<failure message=\"%s\" type=\"%s\"/>\n"),
+					*EscapeXml(Message.Text),
+					*SeverityToString(Message.Severity));
+			}
+			if (InfoText.Len() > 0)
+			{
+				Xml += FString::Printf(TEXT("\t\t\t<system-out>%s</system-out>\n"), *EscapeXml(InfoText));
+			}
+			Xml += TEXT("\t\t</testcase>\n");
+		}
+		Xml += TEXT("\t</testsuite>\n</testsuites>\n");
+
+		return FFileHelper::SaveStringToFile(Xml, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	static bool WriteReports(
+		const FString& JsonReportPath,
+		const FString& JUnitReportPath,
+		TArray<FBlueprintReport>& Reports)
+	{
+		// Stable order independent of how the blueprints were distributed between processes
+		Reports.StableSort([](const FBlueprintReport& A, const FBlueprintReport& B) {
+			const int32 PackageComparison = A.PackageName.Compare(B.PackageName, ESearchCase::IgnoreCase);
+			return PackageComparison != 0 ? PackageComparison < 0
+										  : A.AssetName.Compare(B.AssetName, ESearchCase::IgnoreCase) < 0;
+		});
+
+		bool Success = true;
+		if (JsonReportPath.Len() > 0)
+		{
+			Success &= WriteJsonReport(JsonReportPath, Reports);
+		}
+		if (JUnitReportPath.Len() > 0)
+		{
+			Success &= WriteJUnitReport(JUnitReportPath, Reports);
+		}
+		if (Success == false)
+		{
+			UE_LOG(LogOUUBlueprintValidationCommandlet, Error, TEXT("Failed to write validation reports"));
+		}
+		return Success;
+	}
+
+	// Deterministically distribute the assets between NumShards processes and only keep the assets of one shard.
+	// Every process computes the same distribution as long as they work on the same asset registry state.
+	// Assets are assigned from largest to smallest package to the shard with the smallest total package size,
+	// so all shards have roughly the same amount of data to load and validate. A stable hash of the package name is
+	// used to break ties between packages of the same size.
+	static void ShardAssets(
+		TArray<FAssetData>& Assets,
+		int32 ShardIdx,
+		int32 NumShards,
+		const IAssetRegistry& AssetRegistry)
+	{
+		struct FShardableAsset
+		{
+			int32 AssetIdx = INDEX_NONE;
+			int64 DiskSize = 0;
+			uint64 NameHash = 0;
+		};
+
+		TArray<FShardableAsset> ShardableAssets;
+		ShardableAssets.Reserve(Assets.Num());
+		for (int32 AssetIdx = 0; AssetIdx < Assets.Num(); ++AssetIdx)
+		{
+			const FString PackageName = Assets[AssetIdx].PackageName.ToString().ToLower();
+			const auto PackageData = AssetRegistry.GetAssetPackageDataCopy(Assets[AssetIdx].PackageName);
+			ShardableAssets.Add(
+				{AssetIdx,
+				 PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0,
+				 CityHash64(reinterpret_cast<const char*>(*PackageName), PackageName.Len() * sizeof(TCHAR))});
+		}
+		ShardableAssets.Sort([](const FShardableAsset& A, const FShardableAsset& B) {
+			return A.DiskSize != B.DiskSize ? A.DiskSize > B.DiskSize : A.NameHash < B.NameHash;
+		});
+
+		TArray<int64> ShardSizes;
+		ShardSizes.SetNumZeroed(NumShards);
+		TArray<FAssetData> ShardAssets;
+		for (auto& ShardableAsset : ShardableAssets)
+		{
+			int32 TargetShardIdx = 0;
+			for (int32 OtherShardIdx = 1; OtherShardIdx < NumShards; ++OtherShardIdx)
+			{
+				if (ShardSizes[OtherShardIdx] < ShardSizes[TargetShardIdx])
+				{
+					TargetShardIdx = OtherShardIdx;
+				}
+			}
+			// Count every asset with at least 1 byte, so packages without size information are distributed evenly
+			ShardSizes[TargetShardIdx] += FMath::Max<int64>(ShardableAsset.DiskSize, 1);
+			if (TargetShardIdx == ShardIdx)
+			{
+				ShardAssets.Add(Assets[ShardableAsset.AssetIdx]);
+			}
+		}
+
+		ShardAssets.Sort(
+			[](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+		Assets = MoveTemp(ShardAssets);
+	}
+
+	static int32 MergeReports(
+		const FString& ReportFilePatterns,
+		const FString& JsonReportPath,
+		const FString& JUnitReportPath)
+	{
+		TArray<FString> ReportFiles;
+		TArray<FString> Patterns;
+		ReportFilePatterns.ParseIntoArray(OUT Patterns, TEXT(","));
+		for (auto& Pattern : Patterns)
+		{
+			if (Pattern.Contains(TEXT("*")) == false)
+			{
+				ReportFiles.Add(Pattern);
+				continue;
+			}
+
+			TArray<FString> FoundFiles;
+			IFileManager::Get().FindFiles(OUT FoundFiles, *Pattern, true, false);
+			FoundFiles.Sort();
+			for (auto& FoundFile : FoundFiles)
+			{
+				ReportFiles.Add(FPaths::Combine(FPaths::GetPath(Pattern), FoundFile));
+			}
+		}
+
+		TArray<FBlueprintReport> Reports;
+		bool ReadAllReports = true;
+		for (auto& ReportFile : ReportFiles)
+		{
+			if (ReadJsonReport(ReportFile, OUT Reports) == false)
+			{
+				UE_LOG(LogOUUBlueprintValidationCommandlet, Error, TEXT("Failed to read report %s"), *ReportFile);
+				ReadAllReports = false;
+			}
+		}
+
+		const int32 NumFailedBlueprints =
+			Algo::CountIf(Reports, [](const FBlueprintReport& Report) { return Report.HasFailures(); });
+		UE_LOG(
+			LogOUUBlueprintValidationCommandlet,
+			Display,
+			TEXT("Merged %i reports with %i blueprints. %i failed validation."),
+			ReportFiles.Num(),
+			Reports.Num(),
+			NumFailedBlueprints);
+
+		const bool WroteReports = WriteReports(JsonReportPath, JUnitReportPath, Reports);
+		return (ReadAllReports && WroteReports && NumFailedBlueprints == 0) ? 0 : 1;
+	}
+
+	static FBlueprintReport ValidateBlueprint(const UBlueprint& Blueprint)
+	{
+		FScopedBlueprintValidationTimer Timer(Blueprint);
+		FBlueprintReport Report;
+		auto AddMessage = [&Report](TSharedRef<FTokenizedMessage> Message) {
+			Report.Messages.Add({Message->GetSeverity(), Message->ToText().ToString()});
+		};
+		auto AddDiagnostic = [&AddMessage](const FDiagnostic& Diagnostic) {
+			AddMessage(MakeTokenizedMessage(Diagnostic));
+		};
+
+		if (UOUUBlueprintValidationSettings::Get().CheckMaintainabilityMetrics
+			!= EOUUBlueprintValidationSeverity::DoNotValidate)
+		{
+			UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(
+				Blueprint,
+				AddDiagnostic,
+				UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+		}
+		UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(Blueprint, AddDiagnostic);
+		UOUUBlueprintPerFrameCallsValidator::ValidatePerFrameCalls(Blueprint, AddDiagnostic);
+		UOUUBlueprintPureReevaluationValidator::ValidatePureReevaluation(Blueprint, AddDiagnostic);
+		UOUUBlueprintLoopNestingValidator::ValidateLoopNesting(Blueprint, AddDiagnostic);
+		if (UOUUBlueprintValidationSettings::Get().CheckBytecodeCost != EOUUBlueprintValidationSeverity::DoNotValidate)
+		{
+			UOUUBlueprintBytecodeCostValidator::ValidateBytecodeCost(
+				Blueprint,
+				AddDiagnostic,
+				UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+		}
+		UOUUBlueprintInstanceFootprintValidator::ValidateInstanceFootprint(
+			Blueprint,
+			AddDiagnostic,
+			UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+		UOUUBlueprintWidgetBindingsValidator::ValidateWidgetBindings(
+			Blueprint,
+			AddDiagnostic,
+			UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+		UOUUBlueprintReferenceFootprintValidator::ValidateReferenceFootprint(
+			Blueprint.GetPackage()->GetFName(),
+			AddDiagnostic,
+			UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+		return Report;
+	}
+} // namespace OUU::BlueprintValidation
+
+UOUUBlueprintValidationCommandlet::UOUUBlueprintValidationCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UOUUBlueprintValidationCommandlet::Main(const FString& Params)
+{
+	using namespace OUU::BlueprintValidation;
+
+	TArray<FString> Tokens, Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, OUT Tokens, OUT Switches, OUT ParamValues);
+
+	const FString JsonReportPath = ParamValues.FindRef(TEXT("JsonReport"));
+	const FString JUnitReportPath = ParamValues.FindRef(TEXT("JUnitReport"));
+	auto GetIntParam = [&ParamValues](const TCHAR* Name, int32 DefaultValue) -> int32 {
+		const FString* Value = ParamValues.Find(Name);
+		return Value ? FCString::Atoi(**Value) : DefaultValue;
+	};
+	const int32 PrefetchCount = FMath::Max(0, GetIntParam(TEXT("Prefetch"), 16));
+	const int32 GCInterval = FMath::Max(1, GetIntParam(TEXT("GCInterval"), 100));
+	const int32 NumShards = FMath::Max(1, GetIntParam(TEXT("NumShards"), 1));
+	const int32 ShardIdx = GetIntParam(TEXT("Shard"), 0);
+
+	if (const FString* ReportFilePatterns = ParamValues.Find(TEXT("MergeReports")))
+	{
+		return MergeReports(*ReportFilePatterns, JsonReportPath, JUnitReportPath);
+	}
+
+	if (ShardIdx < 0 || ShardIdx >= NumShards)
+	{
+		UE_LOG(
+			LogOUUBlueprintValidationCommandlet,
+			Error,
+			TEXT("Invalid shard index %i (number of shards: %i)"),
+			ShardIdx,
+			NumShards);
+		return 1;
+	}
+
+	TArray<FString> PackagePaths;
+	ParamValues.FindRef(TEXT("PackagePaths")).ParseIntoArray(OUT PackagePaths, TEXT(","));
+	if (PackagePaths.IsEmpty())
+	{
+		PackagePaths.Add(TEXT("/Game"));
+	}
+
+	auto& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	for (auto& PackagePath : PackagePaths)
+	{
+		Filter.PackagePaths.Add(*PackagePath);
+	}
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, OUT Assets);
+	Assets.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+
+	// Shard before skipping assets, so every process reports only the skipped assets of its own shard
+	if (NumShards > 1)
+	{
+		const int32 NumProjectAssets = Assets.Num();
+		ShardAssets(IN OUT Assets, ShardIdx, NumShards, AssetRegistry);
+		UE_LOG(
+			LogOUUBlueprintValidationCommandlet,
+			Display,
+			TEXT("Shard %i/%i: %i of %i blueprints"),
+			ShardIdx,
+			NumShards,
+			Assets.Num(),
+			NumProjectAssets);
+	}
+
+	// Blueprints that passed validation with the current rules when they were saved don't have to be loaded at all.
+	// The reference footprint is not part of the asset registry tags, but can be checked without loading.
+	TArray<FBlueprintReport> Reports;
+	if (Switches.Contains(TEXT("IgnoreAssetRegistryTags")) == false)
+	{
+		Assets.RemoveAll([&Reports](const FAssetData& AssetData) {
+			if (CanSkipValidation(AssetData) == false)
+			{
+				return false;
+			}
+			bool FootprintPassed = true;
+			UOUUBlueprintReferenceFootprintValidator::ValidateReferenceFootprint(
+				AssetData.PackageName,
+				[&FootprintPassed](const FDiagnostic& Diagnostic) {
+					FootprintPassed &= Diagnostic.Severity == EMessageSeverity::Info;
+				},
+				false);
+			if (FootprintPassed == false)
+			{
+				return false;
+			}
+			auto& Report = Reports.AddDefaulted_GetRef();
+			Report.PackageName = AssetData.PackageName.ToString();
+			Report.AssetName = AssetData.AssetName.ToString();
+			Report.Skipped = true;
+			return true;
+		});
+		UE_LOG(
+			LogOUUBlueprintValidationCommandlet,
+			Display,
+			TEXT("Skipping %i blueprints that passed validation according to their asset registry tags"),
+			Reports.Num());
+	}
+
+	UE_LOG(LogOUUBlueprintValidationCommandlet, Display, TEXT("Validating %i blueprints..."), Assets.Num());
+
+	// Packages that finished loading, but were not validated yet.
+	// Strong references, so they are not collected before we get to validate them.
+	TMap<FName, TStrongObjectPtr<UPackage>> LoadedPackages;
+	TArray<int32> LoadRequestIds;
+	LoadRequestIds.Reserve(Assets.Num());
+	auto RequestLoadsUpTo = [&](int32 LastAssetIdx) {
+		while (LoadRequestIds.Num() <= LastAssetIdx && LoadRequestIds.Num() < Assets.Num())
+		{
+			LoadRequestIds.Add(LoadPackageAsync(
+				Assets[LoadRequestIds.Num()].PackageName.ToString(),
+				FLoadPackageAsyncDelegate::CreateLambda(
+					[&LoadedPackages](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result) {
+						if (Result == EAsyncLoadingResult::Succeeded && Package)
+						{
+							LoadedPackages.Add(PackageName, TStrongObjectPtr<UPackage>(Package));
+						}
+					})));
+		}
+	};
+
+	Reports.Reserve(Reports.Num() + Assets.Num());
+	for (int32 AssetIdx = 0; AssetIdx < Assets.Num(); ++AssetIdx)
+	{
+		const auto& AssetData = Assets[AssetIdx];
+		RequestLoadsUpTo(AssetIdx + PrefetchCount);
+
+		const double StartTime = FPlatformTime::Seconds();
+		FlushAsyncLoading(LoadRequestIds[AssetIdx]);
+
+		FBlueprintReport Report;
+		if (auto* Blueprint = Cast<UBlueprint>(AssetData.FastGetAsset(false)))
+		{
+			Report = ValidateBlueprint(*Blueprint);
+		}
+		else
+		{
+			Report.LoadFailed = true;
+			UE_LOG(
+				LogOUUBlueprintValidationCommandlet,
+				Error,
+				TEXT("Failed to load blueprint %s"),
+				*AssetData.GetObjectPathString());
+		}
+		Report.PackageName = AssetData.PackageName.ToString();
+		Report.AssetName = AssetData.AssetName.ToString();
+		Report.DurationSeconds = FPlatformTime::Seconds() - StartTime;
+
+		for (auto& Message : Report.Messages)
+		{
+			if (Message.Severity == EMessageSeverity::Error)
+			{
+				UE_LOG(LogOUUBlueprintValidationCommandlet, Error, TEXT("%s: %s"), *Report.AssetName, *Message.Text);
+			}
+			else if (Message.Severity != EMessageSeverity::Info)
+			{
+				UE_LOG(LogOUUBlueprintValidationCommandlet, Warning, TEXT("%s: %s"), *Report.AssetName, *Message.Text);
+			}
+		}
+		Reports.Add(MoveTemp(Report));
+
+		// Loaded assets are standalone in editor builds, which would keep them alive through every garbage collection.
+		// Same approach as the ResavePackages commandlet.
+		if (auto* Package = FindPackage(nullptr, *AssetData.PackageName.ToString()))
+		{
+			ForEachObjectWithPackage(Package, [](UObject* Object) {
+				Object->ClearFlags(RF_Standalone);
+				return true;
+			});
+		}
+		LoadedPackages.Remove(AssetData.PackageName);
+		if ((AssetIdx + 1) % GCInterval == 0)
+		{
+			UE_LOG(
+				LogOUUBlueprintValidationCommandlet,
+				Display,
+				TEXT("Validated %i/%i blueprints. Collecting garbage..."),
+				AssetIdx + 1,
+				Assets.Num());
+			CollectGarbage(RF_NoFlags);
+		}
+	}
+
+	const int32 NumFailedBlueprints =
+		Algo::CountIf(Reports, [](const FBlueprintReport& Report) { return Report.HasFailures(); });
+	UE_LOG(
+		LogOUUBlueprintValidationCommandlet,
+		Display,
+		TEXT("Validated %i blueprints. %i failed validation."),
+		Reports.Num(),
+		NumFailedBlueprints);
+
+	const bool WroteReports = WriteReports(JsonReportPath, JUnitReportPath, Reports);
+	return (NumFailedBlueprints == 0 && WroteReports) ? 0 : 1;
+}
@@ -5,9 +5,18 @@
 #include "Editor/UMGEditor/Public/Settings/WidgetDesignerSettings.h"
 #include "Editor/UMGEditor/Public/WidgetBlueprint.h"
 #include "KismetCompiler.h"
+#include "OUUBlueprintAsyncValidation.h"
+#include "OUUBlueprintBytecodeCostValidator.h"
+#include "OUUBlueprintCompileProfiler.h"
 #include "OUUBlueprintDisallowedNodesValidator.h"
+#include "OUUBlueprintInstanceFootprintValidator.h"
+#include "OUUBlueprintLoopNestingValidator.h"
 #include "OUUBlueprintMaintainabilityValidator.h"
+#include "OUUBlueprintPerFrameCallsValidator.h"
+#include "OUUBlueprintPureReevaluationValidator.h"
 #include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintWidgetBindingsValidator.h"
 
 void UOUUBlueprintValidationCompilerExtension::ProcessBlueprintCompiled(
 	const FKismetCompilerContext& CompilationContext,
@@ -19,21 +28,50 @@ void UOUUBlueprintValidationCompilerExtension::ProcessBlueprintCompiled(
 		return;
 	}
 
-	bool ShouldLogMetrics = UOUUBlueprintValidationSettings::Get().LogMetricsOnBlueprintCompile;
+	// Before the validation, so it's not included in the compile duration
+	OUU::BlueprintValidation::FBlueprintCompileProfiler::Get().RecordCompiledBlueprint(CompilationContext);
 
-	CompilationContext.MessageLog.BeginEvent(TEXT("ValidateMaintainability"));
-	UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(
-		*CompilationContext.Blueprint,
-		[&](TSharedRef<FTokenizedMessage> Message) { CompilationContext.MessageLog.AddTokenizedMessage(Message); },
-		ShouldLogMetrics);
-	CompilationContext.MessageLog.EndEvent();
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_CompilerExtension);
+	OUU_BPV_TRACE_OBJECT_SCOPE(CompilationContext.Blueprint);
+	OUU::BlueprintValidation::FScopedBlueprintValidationTimer Timer(*CompilationContext.Blueprint);
+
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	bool ShouldLogMetrics = Settings.LogMetricsOnBlueprintCompile;
 
+	if (Settings.ValidateMaintainabilityAsynchronouslyOnCompile)
+	{
+		OUU::BlueprintValidation::FAsyncMaintainabilityValidation::Get().Launch(
+			*CompilationContext.Blueprint,
+			ShouldLogMetrics);
+	}
+	else
+	{
+		CompilationContext.MessageLog.BeginEvent(TEXT("ValidateMaintainability"));
+		UOUUBlueprintMaintainabilityValidator::ValidateMaintainability(
+			*CompilationContext.Blueprint,
+			[&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+				CompilationContext.MessageLog.AddTokenizedMessage(
+					OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+			},
+			ShouldLogMetrics);
+		CompilationContext.MessageLog.EndEvent();
+	}
+
+	// Findings on individual nodes are also shown on the nodes, like the messages of the compiler itself
+	auto AddDiagnosticToNode = [&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+		OUU::BlueprintValidation::AnnotateNode(Diagnostic);
+		CompilationContext.MessageLog.AddTokenizedMessage(
+			OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+	};
+
+	// Disallowed nodes are cheap to find and should fail the compilation, so they are always validated synchronously
 	CompilationContext.MessageLog.BeginEvent(TEXT("ValidateDisallowedNodes"));
-	UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(
-		*CompilationContext.Blueprint,
-		[&](TSharedRef<FTokenizedMessage> Message) { CompilationContext.MessageLog.AddTokenizedMessage(Message); });
+	UOUUBlueprintDisallowedNodesValidator::ValidateDisallowedNodes(*CompilationContext.Blueprint, AddDiagnosticToNode);
 	CompilationContext.MessageLog.EndEvent();
 
+	// The performance checks (see ValidateCompiledBlueprint) are too expensive to run on every compilation. They only
+	// run after the asynchronous maintainability validation and on asset validation.
+
 	if (ShouldLogMetrics && CompilationContext.Blueprint->IsA<UWidgetBlueprint>()
 		&& (CompilationContext.MessageLog.NumErrors + CompilationContext.MessageLog.NumWarnings) == 0)
 	{
@@ -42,4 +80,33 @@ void UOUUBlueprintValidationCompilerExtension::ProcessBlueprintCompiled(
 		// dismiss/close the compiler results tab.
 		GetMutableDefault<UWidgetDesignerSettings>()->DismissOnCompile = DoC_Never;
 	}
+
+	OUU::BlueprintValidation::FBlueprintCompileProfiler::Get().RestartBatchTimer();
+}
+
+void UOUUBlueprintValidationCompilerExtension::ValidateCompiledBlueprint(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+	bool LogMetrics)
+{
+	auto AddDiagnosticToNode = [&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+		OUU::BlueprintValidation::AnnotateNode(Diagnostic);
+		DiagnosticFunction(Diagnostic);
+	};
+
+	UOUUBlueprintPerFrameCallsValidator::ValidatePerFrameCalls(Blueprint, AddDiagnosticToNode);
+	UOUUBlueprintPureReevaluationValidator::ValidatePureReevaluation(Blueprint, AddDiagnosticToNode);
+	UOUUBlueprintLoopNestingValidator::ValidateLoopNesting(Blueprint, AddDiagnosticToNode);
+
+	if (UOUUBlueprintValidationSettings::Get().CheckBytecodeCost != EOUUBlueprintValidationSeverity::DoNotValidate)
+	{
+		UOUUBlueprintBytecodeCostValidator::ValidateBytecodeCost(Blueprint, DiagnosticFunction, LogMetrics);
+	}
+
+	UOUUBlueprintInstanceFootprintValidator::ValidateInstanceFootprint(Blueprint, DiagnosticFunction, LogMetrics);
+
+	if (Blueprint.IsA<UWidgetBlueprint>())
+	{
+		UOUUBlueprintWidgetBindingsValidator::ValidateWidgetBindings(Blueprint, DiagnosticFunction, LogMetrics);
+	}
 }
@@ -0,0 +1,178 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintValidationRules.h"
+
+#include "Hash/xxhash.h"
+#include "OUUBlueprintValidationSettings.h"
+
+namespace OUU::BlueprintValidation
+{
+	static TUniquePtr<FCompiledValidationRules> GCompiledValidationRules;
+
+	void FCompiledValidationRules::Startup()
+	{
+		GCompiledValidationRules = TUniquePtr<FCompiledValidationRules>(new FCompiledValidationRules());
+	}
+
+	void FCompiledValidationRules::Shutdown() { GCompiledValidationRules.Reset(); }
+
+	FCompiledValidationRules& FCompiledValidationRules::Get()
+	{
+		check(IsInGameThread());
+		GCompiledValidationRules->CompileIfNecessary();
+		return *GCompiledValidationRules;
+	}
+
+	FCompiledValidationRules::FCompiledValidationRules()
+	{
+		GetMutableDefault<UOUUBlueprintValidationSettings>()->OnSettingChanged().AddRaw(
+			this,
+			&FCompiledValidationRules::HandleSettingsChanged);
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(
+			this,
+			&FCompiledValidationRules::HandlePostGarbageCollect);
+		FCoreUObjectDelegates::OnObjectsReinstanced.AddRaw(
+			this,
+			&FCompiledValidationRules::HandleObjectsReinstanced);
+	}
+
+	FCompiledValidationRules::~FCompiledValidationRules()
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+		FCoreUObjectDelegates::OnObjectsReinstanced.RemoveAll(this);
+		if (UObjectInitialized())
+		{
+			GetMutableDefault<UOUUBlueprintValidationSettings>()->OnSettingChanged().RemoveAll(this);
+		}
+	}
+
+	const FString* FCompiledValidationRules::FindDisallowedFunctionReason(const UFunction& Function)
+	{
+		return DisallowedFunctions.Match(Function);
+	}
+
+	const FString* FCompiledValidationRules::FindDisallowedPerFrameFunctionReason(const UFunction& Function)
+	{
+		return DisallowedPerFrameFunctions.Match(Function);
+	}
+
+	bool FCompiledValidationRules::IsCheapPureFunction(const UFunction& Function)
+	{
+		return CheapPureFunctions.Match(Function) != nullptr;
+	}
+
+	bool FCompiledValidationRules::IsBlueprintCastAllowed(const UClass& TargetType)
+	{
+		const FObjectKey TargetTypeKey(&TargetType);
+		if (const bool* MemoizedVerdict = MemoizedCastVerdicts.Find(TargetTypeKey))
+		{
+			return *MemoizedVerdict;
+		}
+
+		bool IsAllowed = false;
+		for (const UClass* Class = &TargetType; Class && IsAllowed == false; Class = Class->GetSuperClass())
+		{
+			IsAllowed = AllowedCastBaseClasses.Contains(FTopLevelAssetPath(Class));
+		}
+		MemoizedCastVerdicts.Add(TargetTypeKey, IsAllowed);
+		return IsAllowed;
+	}
+
+	// Settings that can't change whether a blueprint passes validation with the rules that are summarized in the asset
+	// registry tags: Display, logging, caching and profiling options, and the reference footprint, which is not part of
+	// the summary.
+	static bool IsIgnoredBySettingsHash(FName PropertyName)
+	{
+		using ThisClass = UOUUBlueprintValidationSettings;
+		static const TSet<FName> IgnoredPropertyNames = {
+			GET_MEMBER_NAME_CHECKED(ThisClass, CheckReferenceFootprint),
+			GET_MEMBER_NAME_CHECKED(ThisClass, MaxReferencedPackages),
+			GET_MEMBER_NAME_CHECKED(ThisClass, MaxReferencedSizeMB),
+			GET_MEMBER_NAME_CHECKED(ThisClass, MaxReferencedSizePerAssetClassMB),
+			GET_MEMBER_NAME_CHECKED(ThisClass, NumReportedReferenceChains),
+			GET_MEMBER_NAME_CHECKED(ThisClass, ProfileBlueprintCompilation),
+			GET_MEMBER_NAME_CHECKED(ThisClass, MaxCompileProfileLogSizeKB),
+			GET_MEMBER_NAME_CHECKED(ThisClass, LogMetricsOnBlueprintCompile),
+			GET_MEMBER_NAME_CHECKED(ThisClass, ValidateMaintainabilityAsynchronouslyOnCompile),
+			GET_MEMBER_NAME_CHECKED(ThisClass, ShowLiveMetricsInBlueprintEditor),
+			GET_MEMBER_NAME_CHECKED(ThisClass, LogMetricsOnAssetValidate),
+			GET_MEMBER_NAME_CHECKED(ThisClass, MaintainabilityDocumentationURL),
+			GET_MEMBER_NAME_CHECKED(ThisClass, UsePersistentMetricsCache)};
+		return IgnoredPropertyNames.Contains(PropertyName);
+	}
+
+	static uint64 ComputeSettingsHash(const UOUUBlueprintValidationSettings& Settings)
+	{
+		FXxHash64Builder Builder;
+		FString PropertyValue;
+		for (TFieldIterator<FProperty> PropertyIt(Settings.GetClass()); PropertyIt; ++PropertyIt)
+		{
+			if (PropertyIt->HasAnyPropertyFlags(CPF_Config) == false || IsIgnoredBySettingsHash(PropertyIt->GetFName()))
+			{
+				continue;
+			}
+
+			PropertyValue = PropertyIt->GetName();
+			PropertyIt->ExportText_InContainer(0, IN OUT PropertyValue, &Settings, &Settings, nullptr, PPF_None);
+			Builder.Update(*PropertyValue, PropertyValue.Len() * sizeof(TCHAR));
+		}
+		return Builder.Finalize().Hash;
+	}
+
+	void FCompiledValidationRules::CompileIfNecessary()
+	{
+		if (IsCompiled)
+		{
+			return;
+		}
+
+		auto& Settings = UOUUBlueprintValidationSettings::Get();
+		DisallowedFunctions = FFunctionPatternMatcher(Settings.DisallowedFunctionPaths);
+		DisallowedPerFrameFunctions = FFunctionPatternMatcher(Settings.DisallowedPerFrameFunctionPaths);
+		HasDisallowedPerFrameFunctionPaths = Settings.DisallowedPerFrameFunctionPaths.Num() > 0;
+
+		TMap<FString, FString> CheapPureFunctionPatterns;
+		for (auto& Path : Settings.CheapPureFunctionPaths)
+		{
+			CheapPureFunctionPatterns.Add(Path);
+		}
+		CheapPureFunctions = FFunctionPatternMatcher(CheapPureFunctionPatterns);
+
+		AllowedCastBaseClasses.Reset();
+		for (auto& Class : Settings.AllowBlueprintCastToChildrenOf)
+		{
+			const FTopLevelAssetPath ClassPath = Class.ToSoftObjectPath().GetAssetPath();
+			if (ClassPath.IsValid())
+			{
+				AllowedCastBaseClasses.Add(ClassPath);
+			}
+		}
+		MemoizedCastVerdicts.Reset();
+
+		SettingsHash = ComputeSettingsHash(Settings);
+		IsCompiled = true;
+	}
+
+	void FCompiledValidationRules::HandleSettingsChanged(
+		UObject* Settings,
+		FPropertyChangedEvent& PropertyChangedEvent)
+	{
+		IsCompiled = false;
+	}
+
+	void FCompiledValidationRules::HandlePostGarbageCollect()
+	{
+		// Memoized results are keyed by object keys, so they can't be mixed up with new objects, but we don't want
+		// the memoization to grow indefinitely with reloaded functions.
+		DisallowedFunctions.ResetMemoizedResults();
+		DisallowedPerFrameFunctions.ResetMemoizedResults();
+		CheapPureFunctions.ResetMemoizedResults();
+		MemoizedCastVerdicts.Reset();
+	}
+
+	void FCompiledValidationRules::HandleObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap)
+	{
+		// Recompiled blueprint classes may have been reparented
+		MemoizedCastVerdicts.Reset();
+	}
+} // namespace OUU::BlueprintValidation
@@ -0,0 +1,65 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "OUUBlueprintFunctionPatternMatcher.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/TopLevelAssetPath.h"
+
+namespace OUU::BlueprintValidation
+{
+	// Rules from the project settings compiled into data structures that are fast to query during validation.
+	// The rules are compiled lazily and recompiled after the settings changed.
+	// Must only be used from the game thread.
+	class FCompiledValidationRules
+	{
+	public:
+		// Called by the module
+		static void Startup();
+		static void Shutdown();
+
+		static FCompiledValidationRules& Get();
+
+		~FCompiledValidationRules();
+
+		// @returns the reason why the function is disallowed or nullptr if it's allowed.
+		const FString* FindDisallowedFunctionReason(const UFunction& Function);
+
+		// @returns the reason why the function is disallowed in per-frame code or nullptr if it's allowed.
+		const FString* FindDisallowedPerFrameFunctionReason(const UFunction& Function);
+		bool HasDisallowedPerFrameFunctions() const { return HasDisallowedPerFrameFunctionPaths; }
+
+		// @returns whether the function is allowed to be evaluated any number of times in pure expressions.
+		bool IsCheapPureFunction(const UFunction& Function);
+
+		// @returns whether TargetType is a child of any class in the cast allowlist.
+		bool IsBlueprintCastAllowed(const UClass& TargetType);
+
+		// Hash of all config properties of the validation settings that affect the validation summary.
+		uint64 GetSettingsHash() const { return SettingsHash; }
+
+	private:
+		FCompiledValidationRules();
+
+		void CompileIfNecessary();
+
+		void HandleSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent);
+		void HandlePostGarbageCollect();
+		void HandleObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap);
+
+		bool IsCompiled = false;
+		uint64 SettingsHash = 0;
+		FFunctionPatternMatcher DisallowedFunctions;
+		FFunctionPatternMatcher DisallowedPerFrameFunctions;
+		bool HasDisallowedPerFrameFunctionPaths = false;
+		FFunctionPatternMatcher CheapPureFunctions;
+
+		// Class paths of the cast allowlist. Checked against the super class chain of cast targets, so allowlisted
+		// classes don't have to be resolved or loaded.
+		TSet<FTopLevelAssetPath> AllowedCastBaseClasses;
+		// Allowed verdict per cast target class
+		TMap<FObjectKey, bool> MemoizedCastVerdicts;
+	};
+} // namespace OUU::BlueprintValidation
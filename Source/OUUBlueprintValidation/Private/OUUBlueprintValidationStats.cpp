@@ -0,0 +1,174 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintValidationStats.h"
+
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+DEFINE_STAT(STAT_OUUBPV_ValidateMaintainability);
+DEFINE_STAT(STAT_OUUBPV_ValidateDisallowedNodes);
+DEFINE_STAT(STAT_OUUBPV_ValidateBytecodeCost);
+DEFINE_STAT(STAT_OUUBPV_ValidatePerFrameCalls);
+DEFINE_STAT(STAT_OUUBPV_ValidatePureReevaluation);
+DEFINE_STAT(STAT_OUUBPV_ValidateLoopNesting);
+DEFINE_STAT(STAT_OUUBPV_ValidateWidgetBindings);
+DEFINE_STAT(STAT_OUUBPV_ValidateReferenceFootprint);
+DEFINE_STAT(STAT_OUUBPV_ValidateInstanceFootprint);
+DEFINE_STAT(STAT_OUUBPV_CompilerExtension);
+DEFINE_STAT(STAT_OUUBPV_SummarizeAssetRegistryTags);
+DEFINE_STAT(STAT_OUUBPV_BuildGraphSnapshot);
+DEFINE_STAT(STAT_OUUBPV_ComputeGraphMetrics);
+DEFINE_STAT(STAT_OUUBPV_AnalyzePureExpressions);
+DEFINE_STAT(STAT_OUUBPV_FindDisallowedNodes);
+DEFINE_STAT(STAT_OUUBPV_FindPerFrameNodes);
+DEFINE_STAT(STAT_OUUBPV_AnalyzePureReevaluation);
+DEFINE_STAT(STAT_OUUBPV_ComputeLoopNesting);
+DEFINE_STAT(STAT_OUUBPV_ComputeReferenceFootprint);
+DEFINE_STAT(STAT_OUUBPV_ComputePendingMetrics);
+DEFINE_STAT(STAT_OUUBPV_DerivedDataCacheGet);
+DEFINE_STAT(STAT_OUUBPV_DerivedDataCachePut);
+DEFINE_STAT(STAT_OUUBPV_ValidatedBlueprints);
+DEFINE_STAT(STAT_OUUBPV_AnalyzedGraphs);
+DEFINE_STAT(STAT_OUUBPV_AnalyzedNodes);
+DEFINE_STAT(STAT_OUUBPV_AnalysisCacheHits);
+DEFINE_STAT(STAT_OUUBPV_AnalysisCacheMisses);
+DEFINE_STAT(STAT_OUUBPV_DerivedDataCacheHits);
+
+UE_TRACE_CHANNEL_DEFINE(OUUBlueprintValidationChannel);
+
+namespace OUU::BlueprintValidation
+{
+	struct FBlueprintValidationTiming
+	{
+		int32 NumValidations = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+		double LastSeconds = 0.0;
+		// Of the last validation
+		int32 NumGraphs = 0;
+		int32 NumNodes = 0;
+		// Of all validations
+		int32 NumCacheHits = 0;
+		int32 NumCacheMisses = 0;
+	};
+
+	// Timings of all blueprints validated in this session by blueprint path
+	static FCriticalSection GTimingsCriticalSection;
+	static TMap<FString, FBlueprintValidationTiming> GBlueprintTimings;
+
+	static thread_local FScopedBlueprintValidationTimer* GCurrentTimer = nullptr;
+
+	FScopedBlueprintValidationTimer::FScopedBlueprintValidationTimer(const UBlueprint& InBlueprint) :
+		Blueprint(InBlueprint), OuterTimer(GCurrentTimer), StartTime(FPlatformTime::Seconds())
+	{
+		GCurrentTimer = this;
+	}
+
+	FScopedBlueprintValidationTimer::~FScopedBlueprintValidationTimer()
+	{
+		GCurrentTimer = OuterTimer;
+		if (OuterTimer)
+		{
+			OuterTimer->Graphs.Append(Graphs);
+			OuterTimer->NumNodes += NumNodes;
+			OuterTimer->NumCacheHits += NumCacheHits;
+			OuterTimer->NumCacheMisses += NumCacheMisses;
+			return;
+		}
+
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+		INC_DWORD_STAT(STAT_OUUBPV_ValidatedBlueprints);
+
+		FScopeLock Lock(&GTimingsCriticalSection);
+		auto& Timing = GBlueprintTimings.FindOrAdd(Blueprint.GetPathName());
+		Timing.NumValidations++;
+		Timing.TotalSeconds += Seconds;
+		Timing.MaxSeconds = FMath::Max(Timing.MaxSeconds, Seconds);
+		Timing.LastSeconds = Seconds;
+		Timing.NumGraphs = Graphs.Num();
+		Timing.NumNodes = NumNodes;
+		Timing.NumCacheHits += NumCacheHits;
+		Timing.NumCacheMisses += NumCacheMisses;
+	}
+
+	void FScopedBlueprintValidationTimer::AddGraph(const UEdGraph& Graph, bool CacheHit)
+	{
+		INC_DWORD_STAT(CacheHit ? STAT_OUUBPV_AnalysisCacheHits : STAT_OUUBPV_AnalysisCacheMisses);
+		if (CacheHit == false)
+		{
+			INC_DWORD_STAT(STAT_OUUBPV_AnalyzedGraphs);
+			INC_DWORD_STAT_BY(STAT_OUUBPV_AnalyzedNodes, Graph.Nodes.Num());
+		}
+
+		auto* Timer = GCurrentTimer;
+		if (Timer == nullptr)
+		{
+			return;
+		}
+		(CacheHit ? Timer->NumCacheHits : Timer->NumCacheMisses)++;
+		bool IsAlreadyCounted = false;
+		Timer->Graphs.Add(&Graph, &IsAlreadyCounted);
+		if (IsAlreadyCounted == false)
+		{
+			Timer->NumNodes += Graph.Nodes.Num();
+		}
+	}
+
+	static void ListSlowestBlueprints(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const int32 MaxCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+
+		TArray<TPair<FString, FBlueprintValidationTiming>> Timings;
+		{
+			FScopeLock Lock(&GTimingsCriticalSection);
+			Timings = GBlueprintTimings.Array();
+		}
+		Timings.Sort([](const auto& A, const auto& B) { return A.Value.TotalSeconds > B.Value.TotalSeconds; });
+
+		Ar.Logf(
+			TEXT("Slowest %i of %i validated blueprints:"),
+			FMath::Min(MaxCount, Timings.Num()),
+			Timings.Num());
+		Ar.Logf(
+			TEXT("%10s %10s %10s %6s %6s %7s %9s  %s"),
+			TEXT("Total ms"),
+			TEXT("Max ms"),
+			TEXT("Last ms"),
+			TEXT("Count"),
+			TEXT("Graphs"),
+			TEXT("Nodes"),
+			TEXT("Cache %"),
+			TEXT("Blueprint"));
+		for (int32 Idx = 0; Idx < FMath::Min(MaxCount, Timings.Num()); ++Idx)
+		{
+			const auto& Timing = Timings[Idx].Value;
+			const int32 NumCacheLookups = Timing.NumCacheHits + Timing.NumCacheMisses;
+			Ar.Logf(
+				TEXT("%10.2f %10.2f %10.2f %6i %6i %7i %8.0f%%  %s"),
+				Timing.TotalSeconds * 1000.0,
+				Timing.MaxSeconds * 1000.0,
+				Timing.LastSeconds * 1000.0,
+				Timing.NumValidations,
+				Timing.NumGraphs,
+				Timing.NumNodes,
+				NumCacheLookups > 0 ? 100.0 * Timing.NumCacheHits / NumCacheLookups : 0.0,
+				*Timings[Idx].Key);
+		}
+	}
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice ListSlowestBlueprintsCommand(
+		TEXT("OUUBlueprintValidation.ListSlowestBlueprints"),
+		TEXT("List the blueprints that took the longest to validate in this session (total time of all validations). "
+			 "Optional argument: number of blueprints to list (default 20)."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&ListSlowestBlueprints));
+
+	static FAutoConsoleCommand ResetTimingsCommand(
+		TEXT("OUUBlueprintValidation.ResetTimings"),
+		TEXT("Discard the blueprint validation timings collected for OUUBlueprintValidation.ListSlowestBlueprints"),
+		FConsoleCommandDelegate::CreateLambda([]() {
+			FScopeLock Lock(&GTimingsCriticalSection);
+			GBlueprintTimings.Reset();
+		}));
+} // namespace OUU::BlueprintValidation
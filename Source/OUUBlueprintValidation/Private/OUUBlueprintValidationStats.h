@@ -0,0 +1,203 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+class UBlueprint;
+class UEdGraph;
+
+DECLARE_STATS_GROUP(TEXT("OUU Blueprint Validation"), STATGROUP_OUUBlueprintValidation, STATCAT_Advanced);
+
+// Validator entry points
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Maintainability"),
+	STAT_OUUBPV_ValidateMaintainability,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Disallowed Nodes"),
+	STAT_OUUBPV_ValidateDisallowedNodes,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Bytecode Cost"),
+	STAT_OUUBPV_ValidateBytecodeCost,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Per-Frame Calls"),
+	STAT_OUUBPV_ValidatePerFrameCalls,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Pure Re-Evaluation"),
+	STAT_OUUBPV_ValidatePureReevaluation,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Loop Nesting"),
+	STAT_OUUBPV_ValidateLoopNesting,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Widget Bindings"),
+	STAT_OUUBPV_ValidateWidgetBindings,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Reference Footprint"),
+	STAT_OUUBPV_ValidateReferenceFootprint,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Validate Instance Footprint"),
+	STAT_OUUBPV_ValidateInstanceFootprint,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Compiler Extension"),
+	STAT_OUUBPV_CompilerExtension,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Summarize Asset Registry Tags"),
+	STAT_OUUBPV_SummarizeAssetRegistryTags,
+	STATGROUP_OUUBlueprintValidation,
+	);
+
+// Per graph analysis
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Build Graph Snapshot"),
+	STAT_OUUBPV_BuildGraphSnapshot,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Compute Graph Metrics"),
+	STAT_OUUBPV_ComputeGraphMetrics,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Analyze Pure Expressions"),
+	STAT_OUUBPV_AnalyzePureExpressions,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Find Disallowed Nodes"),
+	STAT_OUUBPV_FindDisallowedNodes,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Find Per-Frame Nodes"),
+	STAT_OUUBPV_FindPerFrameNodes,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Analyze Pure Re-Evaluation"),
+	STAT_OUUBPV_AnalyzePureReevaluation,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Compute Loop Nesting"),
+	STAT_OUUBPV_ComputeLoopNesting,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Compute Reference Footprint"),
+	STAT_OUUBPV_ComputeReferenceFootprint,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Compute Pending Metrics"),
+	STAT_OUUBPV_ComputePendingMetrics,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Derived Data Cache Get"),
+	STAT_OUUBPV_DerivedDataCacheGet,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_CYCLE_STAT_EXTERN(
+	TEXT("Derived Data Cache Put"),
+	STAT_OUUBPV_DerivedDataCachePut,
+	STATGROUP_OUUBlueprintValidation,
+	);
+
+// Totals since startup
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+	TEXT("Validated Blueprints"),
+	STAT_OUUBPV_ValidatedBlueprints,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+	TEXT("Analyzed Graphs"),
+	STAT_OUUBPV_AnalyzedGraphs,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+	TEXT("Analyzed Nodes"),
+	STAT_OUUBPV_AnalyzedNodes,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+	TEXT("Analysis Cache Hits"),
+	STAT_OUUBPV_AnalysisCacheHits,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+	TEXT("Analysis Cache Misses"),
+	STAT_OUUBPV_AnalysisCacheMisses,
+	STATGROUP_OUUBlueprintValidation,
+	);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+	TEXT("Derived Data Cache Hits"),
+	STAT_OUUBPV_DerivedDataCacheHits,
+	STATGROUP_OUUBlueprintValidation,
+	);
+
+// Insights trace channel of the plugin. Enable with -trace=cpu,OUUBlueprintValidation
+UE_TRACE_CHANNEL_EXTERN(OUUBlueprintValidationChannel);
+
+// Cycle stat that also shows up as CPU timing event on the trace channel of the plugin.
+#define OUU_BPV_SCOPE_CYCLE_COUNTER(Stat)                                                                             \
+	SCOPE_CYCLE_COUNTER(Stat);                                                                                         \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Stat, OUUBlueprintValidationChannel)
+
+// CPU timing event named after an object (e.g. a graph). The name is only looked up if the channel is enabled.
+#define OUU_BPV_TRACE_OBJECT_SCOPE(Object)                                                                            \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(                                                                     \
+		UE_TRACE_CHANNELEXPR_IS_ENABLED(OUUBlueprintValidationChannel) ? *GetNameSafe(Object) : TEXT(""),              \
+		OUUBlueprintValidationChannel)
+
+namespace OUU::BlueprintValidation
+{
+	// Times the validation of a single blueprint and records the result for the slowest blueprints summary
+	// (console command OUUBlueprintValidation.ListSlowestBlueprints).
+	// Scopes can be nested, e.g. compiler extension -> validators. Only the outermost scope of a thread is recorded,
+	// inner scopes add their graphs to it.
+	class FScopedBlueprintValidationTimer
+	{
+	public:
+		explicit FScopedBlueprintValidationTimer(const UBlueprint& Blueprint);
+		~FScopedBlueprintValidationTimer();
+
+		UE_NONCOPYABLE(FScopedBlueprintValidationTimer);
+
+		// Count a graph lookup of the analysis cache for the blueprint that is currently validated on this thread.
+		static void AddGraph(const UEdGraph& Graph, bool CacheHit);
+
+	private:
+		const UBlueprint& Blueprint;
+		FScopedBlueprintValidationTimer* OuterTimer = nullptr;
+		double StartTime = 0.0;
+
+		TSet<const UEdGraph*> Graphs;
+		int32 NumNodes = 0;
+		int32 NumCacheHits = 0;
+		int32 NumCacheMisses = 0;
+	};
+} // namespace OUU::BlueprintValidation
@@ -37,20 +37,6 @@ namespace OUU::BlueprintValidation
 		return false;
 	}
 
-	TArray<UEdGraphPin*> GetInputParameterPins(UEdGraphNode& Node)
-	{
-		// interpret all non exec inputs of a node as a "parameter"
-		TArray<UEdGraphPin*> ParameterPins;
-		for (auto& Pin : Node.Pins)
-		{
-			if (Pin->Direction == EGPD_Input && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
-			{
-				ParameterPins.Add(Pin);
-			}
-		}
-		return ParameterPins;
-	}
-
 	void OnMessageLogLinkActivated(const TSharedRef<IMessageToken>& Token)
 	{
 		if (Token->GetType() == EMessageToken::Object)
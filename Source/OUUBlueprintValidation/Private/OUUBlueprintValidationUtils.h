@@ -13,8 +13,6 @@ namespace OUU::BlueprintValidation
 	// should return true for macro entry, function entry and event graph event nodes
 	bool IsBlueprintEntryNode(UEdGraphNode& Node);
 
-	TArray<UEdGraphPin*> GetInputParameterPins(UEdGraphNode& Node);
-
 	void OnMessageLogLinkActivated(const TSharedRef<IMessageToken>& Token);
 
 	TSharedRef<IMessageToken> CreateGraphOrNodeToken(const UObject* InObject);
@@ -0,0 +1,159 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#include "OUUBlueprintWidgetBindingsValidator.h"
+
+#include "Blueprint/UserWidget.h"
+#include "EdGraphSchema_K2.h"
+#include "Editor/UMGEditor/Public/WidgetBlueprint.h"
+#include "K2Node_Event.h"
+#include "Misc/DataValidation.h"
+#include "OUUBlueprintAnalysisCache.h"
+#include "OUUBlueprintAssetRegistryTags.h"
+#include "OUUBlueprintValidationSettings.h"
+#include "OUUBlueprintValidationStats.h"
+#include "OUUBlueprintValidationUtils.h"
+
+bool UOUUBlueprintWidgetBindingsValidator::CanValidateAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& InContext) const
+{
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	return IsValid(Cast<UWidgetBlueprint>(InAsset))
+		&& Settings.CheckWidgetBindings != EOUUBlueprintValidationSeverity::DoNotValidate
+		&& OUU::BlueprintValidation::CanSkipValidation(InAssetData, InAsset) == false;
+}
+
+EDataValidationResult UOUUBlueprintWidgetBindingsValidator::ValidateLoadedAsset_Implementation(
+	const FAssetData& InAssetData,
+	UObject* InAsset,
+	FDataValidationContext& Context)
+{
+	const auto& Blueprint = *CastChecked<UBlueprint>(InAsset);
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	ValidateWidgetBindings(
+		Blueprint,
+		[&](const OUU::BlueprintValidation::FDiagnostic& Diagnostic) {
+			Context.AddMessage(OUU::BlueprintValidation::MakeTokenizedMessage(Diagnostic));
+			if (Diagnostic.Severity != EMessageSeverity::Info)
+			{
+				Result = EDataValidationResult::Invalid;
+			}
+		},
+		UOUUBlueprintValidationSettings::Get().LogMetricsOnAssetValidate);
+	return Result;
+}
+
+namespace OUU::BlueprintValidation
+{
+	// Tick events that are actually connected to something
+	static int32 CountWidgetTickOverrides(const UBlueprint& Blueprint)
+	{
+		int32 NumTickOverrides = 0;
+		for (UEdGraph* Graph : Blueprint.UbergraphPages)
+		{
+			if (Graph == nullptr)
+			{
+				continue;
+			}
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				auto* EventNode = Cast<UK2Node_Event>(Node);
+				if (EventNode == nullptr
+					|| EventNode->GetFunctionName() != GET_FUNCTION_NAME_CHECKED(UUserWidget, Tick))
+				{
+					continue;
+				}
+				const auto* ThenPin = EventNode->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output);
+				if (ThenPin && ThenPin->LinkedTo.Num() > 0)
+				{
+					NumTickOverrides++;
+				}
+			}
+		}
+		return NumTickOverrides;
+	}
+} // namespace OUU::BlueprintValidation
+
+void UOUUBlueprintWidgetBindingsValidator::ValidateWidgetBindings(
+	const UBlueprint& Blueprint,
+	TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+	bool LogCosts)
+{
+	using namespace OUU::BlueprintValidation;
+	auto* WidgetBlueprint = Cast<UWidgetBlueprint>(&Blueprint);
+	auto& Settings = UOUUBlueprintValidationSettings::Get();
+	if (WidgetBlueprint == nullptr || Settings.CheckWidgetBindings == EOUUBlueprintValidationSeverity::DoNotValidate)
+	{
+		return;
+	}
+
+	OUU_BPV_SCOPE_CYCLE_COUNTER(STAT_OUUBPV_ValidateWidgetBindings);
+	OUU_BPV_TRACE_OBJECT_SCOPE(&Blueprint);
+	FScopedBlueprintValidationTimer Timer(Blueprint);
+	const EMessageSeverity::Type FailureSeverity = ToMessageSeverity(Settings.CheckWidgetBindings);
+
+	// Functions may be bound to multiple properties. Each binding evaluates the function every frame, but the
+	// complexity of each function only has to be checked once.
+	int32 NumFunctionBindings = 0, NumPropertyBindings = 0;
+	TArray<UEdGraph*> BoundFunctionGraphs;
+	for (auto& Binding : WidgetBlueprint->Bindings)
+	{
+		if (Binding.Kind == EBindingKind::Property)
+		{
+			NumPropertyBindings++;
+			continue;
+		}
+
+		NumFunctionBindings++;
+		auto* FunctionGraph = WidgetBlueprint->FunctionGraphs.FindByPredicate(
+			[&](const UEdGraph* Graph) { return Graph && Graph->GetFName() == Binding.FunctionName; });
+		if (FunctionGraph && IsBlueprintGraph(**FunctionGraph))
+		{
+			BoundFunctionGraphs.AddUnique(*FunctionGraph);
+		}
+	}
+	const int32 NumTickOverrides = CountWidgetTickOverrides(Blueprint);
+
+	const int32 NumPerFrameUpdates = NumFunctionBindings + NumPropertyBindings + NumTickOverrides;
+	const bool TooManyPerFrameUpdates = NumPerFrameUpdates > Settings.MaxPerFrameWidgetUpdates;
+	if (TooManyPerFrameUpdates || (LogCosts && NumPerFrameUpdates > 0))
+	{
+		DiagnosticFunction(FDiagnostic{
+			EDiagnosticRule::WidgetPerFrameUpdates,
+			TooManyPerFrameUpdates ? FailureSeverity : EMessageSeverity::Info,
+			nullptr,
+			{NumPerFrameUpdates,
+			 Settings.MaxPerFrameWidgetUpdates,
+			 NumFunctionBindings,
+			 NumPropertyBindings,
+			 NumTickOverrides}});
+	}
+
+	TArray<FGraphMetrics> BoundFunctionMetrics;
+	FGraphAnalysisCache::Get().GetOrComputeMetrics(BoundFunctionGraphs, OUT BoundFunctionMetrics);
+	for (int32 GraphIdx = 0; GraphIdx < BoundFunctionGraphs.Num(); ++GraphIdx)
+	{
+		const auto& Metrics = BoundFunctionMetrics[GraphIdx];
+		const double CyclomaticComplexity = Settings.CyclomaticComplexityMode == EOUUCyclomaticComplexityMode::McCabe
+			? Metrics.McCabeCyclomaticComplexity
+			: Metrics.CyclomaticComplexity;
+
+		if (Metrics.NodeCount > Settings.MaxWidgetBindingNodeCount)
+		{
+			DiagnosticFunction(FDiagnostic{
+				EDiagnosticRule::WidgetBindingNodeCount,
+				FailureSeverity,
+				BoundFunctionGraphs[GraphIdx],
+				{Metrics.NodeCount, Settings.MaxWidgetBindingNodeCount}});
+		}
+		if (CyclomaticComplexity > Settings.MaxWidgetBindingCyclomaticComplexity)
+		{
+			DiagnosticFunction(FDiagnostic{
+				EDiagnosticRule::WidgetBindingCyclomaticComplexity,
+				FailureSeverity,
+				BoundFunctionGraphs[GraphIdx],
+				{FMath::RoundToInt32(CyclomaticComplexity), Settings.MaxWidgetBindingCyclomaticComplexity}});
+		}
+	}
+}
@@ -0,0 +1,35 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EditorValidatorBase.h"
+#include "OUUBlueprintDiagnostics.h"
+
+#include "OUUBlueprintBytecodeCostValidator.generated.h"
+
+// Validates the estimated VM cost of the compiled bytecode of blueprint functions against the budgets configured in
+// OUUBlueprintValidationSettings
+UCLASS()
+class OUUBLUEPRINTVALIDATION_API UOUUBlueprintBytecodeCostValidator : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+public:
+	// - UEditorValidatorBase
+	bool CanValidateAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InObject,
+		FDataValidationContext& InContext) const override;
+	EDataValidationResult ValidateLoadedAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InAsset,
+		FDataValidationContext& Context) override;
+	// --
+
+	// This implementation is reused for both this asset validator and the BP compiler extension.
+	static void ValidateBytecodeCost(
+		const UBlueprint& Blueprint,
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+		bool LogCosts);
+};
@@ -8,6 +8,22 @@ class UEdGraph;
 
 namespace OUU::BlueprintValidation
 {
+	// Increment whenever the computation of any of the graph metrics below changes.
+	// This invalidates metrics that were persistently cached in the derived data cache.
+	constexpr int32 GraphMetricsVersion = 1;
+
+	// Constants of the formulas below. These are part of the derived data cache key of the persistently cached metrics.
+	namespace MetricConstants
+	{
+		// Each impure node counts as one line of code, pure nodes count as a fraction of that.
+		constexpr double PureNodesPerLineOfCode = 5.0;
+
+		constexpr double MaintainabilityIndexBase = 171.0;
+		constexpr double MaintainabilityIndexHalsteadVolumeFactor = 5.2;
+		constexpr double MaintainabilityIndexCyclomaticComplexityFactor = 0.23;
+		constexpr double MaintainabilityIndexLinesOfCodeFactor = 16.2;
+	} // namespace MetricConstants
+
 	// This is the formula that pieces all the other metrics below together into a maintainability index.
 	// Uses the Microsoft formula from here:
 	// For blueprint, we might get better results with other formulas.
@@ -17,13 +33,19 @@ namespace OUU::BlueprintValidation
 		double Cyclomatic_Complexity,
 		double LinesOfCode)
 	{
+		using namespace MetricConstants;
 		return FMath::Max(
 			0.0,
-			(171.0 - 5.2 * FMath::Loge(FMath::Max(1.0, HalsteadVolume))
-			 - 0.23 * (Cyclomatic_Complexity)-16.2 * FMath::Loge(FMath::Max(1.0, LinesOfCode)))
-				* 100.0 / 171.0);
+			(MaintainabilityIndexBase
+			 - MaintainabilityIndexHalsteadVolumeFactor * FMath::Loge(FMath::Max(1.0, HalsteadVolume))
+			 - MaintainabilityIndexCyclomaticComplexityFactor * (Cyclomatic_Complexity)
+			 - MaintainabilityIndexLinesOfCodeFactor * FMath::Loge(FMath::Max(1.0, LinesOfCode)))
+				* 100.0 / MaintainabilityIndexBase);
 	}
 
+	// The following single metric functions each build a snapshot of the graph and compute all metrics.
+	// Call ComputeGraphMetrics() instead if you need more than one metric.
+
 	// Get Cyclomatic Complexity of a single blueprint graph to estimate the number of different execution paths.
 	// This function does NOT recurse into subgraphs.
 	//
@@ -60,4 +82,24 @@ namespace OUU::BlueprintValidation
 	// Number of comment nodes and node comments
 	OUUBLUEPRINTVALIDATION_API uint32 CountGraphComments(UEdGraph& Graph);
 
+	// All metrics of a single blueprint graph.
+	struct FGraphMetrics
+	{
+		// see ComputeCyclomaticGraphComplexity()
+		double CyclomaticComplexity = 0.0;
+		// True McCabe cyclomatic complexity (E - N + 2P) of the exec flow graph for comparison.
+		// Disconnected exec outputs and nodes without exec outputs lead to an implicit exit node per entry point.
+		// Unlike CyclomaticComplexity this also counts sequence nodes and exec outputs that are connected to the same
+		// pin as branches.
+		double McCabeCyclomaticComplexity = 0.0;
+		FHalsteadComplexity Halstead;
+		double LinesOfCode = 0.0;
+		uint32 CommentCount = 0;
+		int32 NodeCount = 0;
+	};
+
+	// Compute all of the metrics above in a single pass over the graph nodes.
+	// This function does NOT recurse into subgraphs.
+	OUUBLUEPRINTVALIDATION_API FGraphMetrics ComputeGraphMetrics(UEdGraph& Graph);
+
 } // namespace OUU::BlueprintValidation
@@ -0,0 +1,122 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Logging/TokenizedMessage.h"
+
+namespace OUU::BlueprintValidation
+{
+	// Validation rules that can produce a diagnostic.
+	// The comments list the meaning of FDiagnostic::Values for each rule.
+	enum class EDiagnosticRule : uint8
+	{
+		// Number of graphs, max graphs per blueprint
+		GraphCount,
+		// Maintainability index. Limit is the min per graph.
+		MaintainabilityIndex,
+		// Cyclomatic complexity, max per graph
+		CyclomaticComplexity,
+		// Halstead volume, max per graph
+		HalsteadVolume,
+		// Node count, max per graph
+		NodeCount,
+		// Comment percentage, min number of nodes to consider comments. Limit is the min per graph.
+		CommentPercentage,
+		// Summary of all metrics of a graph: Maintainability index, cyclomatic complexity (as configured), Halstead
+		// volume, node count, comment percentage, Galea cyclomatic complexity, McCabe cyclomatic complexity
+		GraphMetrics,
+		// Bytecode instructions of a function, max per function
+		BytecodeInstructions,
+		// Context switches of a function, max per function
+		BytecodeContextSwitches,
+		// Function calls of a function, max per function
+		BytecodeFunctionCalls,
+		// Container copies of a function, max per function
+		BytecodeContainerCopies,
+		// Summary of the bytecode cost of a function: Instructions, context switches, function calls, container copies,
+		// script size in bytes, whether the estimation is complete (0/1)
+		BytecodeCost,
+		// Per-frame updates of a widget, max per widget, function bindings, property bindings, tick overrides
+		WidgetPerFrameUpdates,
+		// Node count of a function bound to a widget property, max per bound function
+		WidgetBindingNodeCount,
+		// Cyclomatic complexity of a function bound to a widget property, max per bound function
+		WidgetBindingCyclomaticComplexity,
+		// Bytes the blueprint adds to every instance, max per blueprint
+		InstanceBytes,
+		// Components of every instance, max per instance
+		ComponentCount,
+		// Summary of the instance footprint: Bytes added per instance, property bytes, ubergraph frame bytes, default
+		// container bytes, components per instance, construction script components, component templates
+		InstanceFootprint,
+		// Cast to a blueprint class that is not allowlisted. No values.
+		BlueprintCast,
+		// Call of a disallowed function. No values, Reason from the project settings.
+		DisallowedFunction,
+		// Call of a function that is disallowed in per-frame code. No values, Reason from the project settings,
+		// RelatedObject is the event, timer or bound function that is executed every frame.
+		PerFrameCall,
+		// Evaluations of a pure node per execution of its graph, max evaluations
+		PureReevaluation,
+		// Depth of nested loops, max depth. RelatedObject is the node containing the innermost loop.
+		LoopNesting,
+		// Number of transitively hard referenced packages, max packages
+		ReferencedPackageCount,
+		// Disk size of all transitively hard referenced packages in bytes, max bytes
+		ReferencedSize,
+		// Number of hard referenced packages of an asset class, their disk size in bytes, max bytes. RelatedName is the
+		// asset class.
+		ReferencedClassSize,
+		// Summary of the hard references: Number of referenced packages, disk size in bytes
+		ReferenceFootprint,
+		// Disk size of a heavy hard referenced package in bytes. ReferenceChain is the chain of references to it.
+		HeavyReference
+	};
+
+	// Compact record of a single validation result.
+	// Validators emit these instead of tokenized messages, so the message text is only formatted if a consumer actually
+	// needs it (see MakeTokenizedMessage()). Validating many graphs that pass all rules does not allocate any text.
+	struct FDiagnostic
+	{
+		static constexpr int32 MaxValues = 7;
+
+		EDiagnosticRule Rule = EDiagnosticRule::GraphMetrics;
+		EMessageSeverity::Type Severity = EMessageSeverity::Info;
+		// Graph or node the diagnostic refers to. Nullptr for diagnostics that refer to the whole blueprint.
+		const UObject* Object = nullptr;
+		int64 Values[MaxValues] = {};
+		// Fractional threshold of rules that are configured with a floating point value. See EDiagnosticRule.
+		double Limit = 0.0;
+		// Second object some rules refer to. See EDiagnosticRule.
+		const UObject* RelatedObject = nullptr;
+		// Reason from the project settings. Only valid while the diagnostic is passed to the diagnostic function.
+		FStringView Reason;
+		// Package the diagnostic refers to if there is no Object, e.g. for blueprints that are not loaded
+		FName PackageName;
+		// Name some rules refer to. See EDiagnosticRule.
+		FName RelatedName;
+		// Packages some rules refer to. Only valid while the diagnostic is passed to the diagnostic function.
+		TConstArrayView<FName> ReferenceChain;
+
+		void SetValues(std::initializer_list<int64> InValues)
+		{
+			check(InValues.size() <= MaxValues);
+			FMemory::Memcpy(Values, InValues.begin(), InValues.size() * sizeof(int64));
+		}
+	};
+
+	// Format the message text of a diagnostic (without the object it refers to).
+	OUUBLUEPRINTVALIDATION_API FText FormatDiagnosticText(const FDiagnostic& Diagnostic);
+
+	// Create a message for the message log / compiler results from a diagnostic.
+	// Includes a link to the object and a help link for metric summaries.
+	OUUBLUEPRINTVALIDATION_API TSharedRef<FTokenizedMessage> MakeTokenizedMessage(const FDiagnostic& Diagnostic);
+
+	// Show the diagnostic on the node it refers to, like a compiler message.
+	// Only meant for compiler results: The annotation is cleared by the next compile, but otherwise saved with the
+	// node. Does nothing if the diagnostic does not refer to a node or the node already has a compiler message.
+	OUUBLUEPRINTVALIDATION_API void AnnotateNode(const FDiagnostic& Diagnostic);
+
+} // namespace OUU::BlueprintValidation
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "EditorValidatorBase.h"
+#include "OUUBlueprintDiagnostics.h"
 
 #include "OUUBlueprintDisallowedNodesValidator.generated.h"
 
@@ -26,7 +27,8 @@ public:
 	// --
 
 	// This implementation is reused for both this asset validator and the BP compiler extension.
+	// Results are reported as diagnostics, which can be turned into messages via MakeTokenizedMessage().
 	static void ValidateDisallowedNodes(
 		const UBlueprint& Blueprint,
-		TFunctionRef<void(TSharedRef<FTokenizedMessage>)> MessageFunction);
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction);
 };
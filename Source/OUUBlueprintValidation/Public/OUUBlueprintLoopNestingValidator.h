@@ -0,0 +1,34 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EditorValidatorBase.h"
+#include "OUUBlueprintDiagnostics.h"
+
+#include "OUUBlueprintLoopNestingValidator.generated.h"
+
+// Validates blueprints for deeply nested loops, whose cost grows polynomially with the number of iterated elements.
+UCLASS()
+class OUUBLUEPRINTVALIDATION_API UOUUBlueprintLoopNestingValidator : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+public:
+	// - UEditorValidatorBase
+	bool CanValidateAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InObject,
+		FDataValidationContext& InContext) const override;
+	EDataValidationResult ValidateLoadedAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InAsset,
+		FDataValidationContext& Context) override;
+	// --
+
+	// This implementation is reused for both this asset validator and the BP compiler extension.
+	// Results are reported as diagnostics, which can be turned into messages via MakeTokenizedMessage().
+	static void ValidateLoopNesting(
+		const UBlueprint& Blueprint,
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction);
+};
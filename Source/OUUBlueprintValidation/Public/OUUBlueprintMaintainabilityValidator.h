@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "EditorValidatorBase.h"
+#include "OUUBlueprintDiagnostics.h"
 
 #include "OUUBlueprintMaintainabilityValidator.generated.h"
 
@@ -26,8 +27,9 @@ public:
 	// --
 
 	// This implementation is reused for both this asset validator and the BP compiler extension.
+	// Results are reported as diagnostics, which can be turned into messages via MakeTokenizedMessage().
 	static void ValidateMaintainability(
 		const UBlueprint& Blueprint,
-		TFunctionRef<void(TSharedRef<FTokenizedMessage>)> MessageFunction,
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
 		bool LogMetrics);
 };
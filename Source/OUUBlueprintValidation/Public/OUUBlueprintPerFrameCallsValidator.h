@@ -0,0 +1,35 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EditorValidatorBase.h"
+#include "OUUBlueprintDiagnostics.h"
+
+#include "OUUBlueprintPerFrameCallsValidator.generated.h"
+
+// Validates blueprints for calls of functions that are disallowed in code that is executed every frame (e.g. from
+// Event Tick, looping timers or UMG property bindings).
+UCLASS()
+class OUUBLUEPRINTVALIDATION_API UOUUBlueprintPerFrameCallsValidator : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+public:
+	// - UEditorValidatorBase
+	bool CanValidateAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InObject,
+		FDataValidationContext& InContext) const override;
+	EDataValidationResult ValidateLoadedAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InAsset,
+		FDataValidationContext& Context) override;
+	// --
+
+	// This implementation is reused for both this asset validator and the BP compiler extension.
+	// Results are reported as diagnostics, which can be turned into messages via MakeTokenizedMessage().
+	static void ValidatePerFrameCalls(
+		const UBlueprint& Blueprint,
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction);
+};
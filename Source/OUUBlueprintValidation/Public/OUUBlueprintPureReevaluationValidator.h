@@ -0,0 +1,35 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EditorValidatorBase.h"
+#include "OUUBlueprintDiagnostics.h"
+
+#include "OUUBlueprintPureReevaluationValidator.generated.h"
+
+// Validates blueprints for pure function calls that are re-evaluated too often, because they feed multiple impure nodes
+// or nodes in loops.
+UCLASS()
+class OUUBLUEPRINTVALIDATION_API UOUUBlueprintPureReevaluationValidator : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+public:
+	// - UEditorValidatorBase
+	bool CanValidateAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InObject,
+		FDataValidationContext& InContext) const override;
+	EDataValidationResult ValidateLoadedAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InAsset,
+		FDataValidationContext& Context) override;
+	// --
+
+	// This implementation is reused for both this asset validator and the BP compiler extension.
+	// Results are reported as diagnostics, which can be turned into messages via MakeTokenizedMessage().
+	static void ValidatePureReevaluation(
+		const UBlueprint& Blueprint,
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction);
+};
@@ -0,0 +1,37 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EditorValidatorBase.h"
+#include "OUUBlueprintDiagnostics.h"
+
+#include "OUUBlueprintReferenceFootprintValidator.generated.h"
+
+// Validates the number and size of all packages that are loaded together with a blueprint because of its transitive
+// hard references. Works on asset registry data, so none of the referenced packages are loaded.
+UCLASS()
+class OUUBLUEPRINTVALIDATION_API UOUUBlueprintReferenceFootprintValidator : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+public:
+	// - UEditorValidatorBase
+	bool CanValidateAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InObject,
+		FDataValidationContext& InContext) const override;
+	EDataValidationResult ValidateLoadedAsset_Implementation(
+		const FAssetData& InAssetData,
+		UObject* InAsset,
+		FDataValidationContext& Context) override;
+	// --
+
+	// This implementation is reused for both this asset validator and the validation commandlet.
+	// Takes the package name instead of the blueprint, so it can also be used for blueprints that are not loaded.
+	// Results are reported as diagnostics, which can be turned into messages via MakeTokenizedMessage().
+	static void ValidateReferenceFootprint(
+		FName PackageName,
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+		bool LogFootprint);
+};
@@ -0,0 +1,41 @@
+﻿// Copyright (c) 2026 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Commandlets/Commandlet.h"
+
+#include "OUUBlueprintValidationCommandlet.generated.h"
+
+// Headless validation of all blueprints in the project with the maintainability, disallowed nodes, per-frame calls,
+// pure re-evaluation, loop nesting, instance footprint, widget bindings, reference footprint and (if enabled) bytecode
+// cost validators.
+// Blueprints are found via the asset registry and loaded one after another with async prefetching. Garbage is
+// collected in regular intervals, so memory stays bounded independent of the project size.
+//
+// Usage:
+// -run=OUUBlueprintValidation
+//     [-PackagePaths=/Game,/MyPlugin]  Package paths to search for blueprints (recursive). Default: /Game
+//     [-JsonReport=<file>]             Write results as JSON
+//     [-JUnitReport=<file>]            Write results as JUnit XML
+//     [-Prefetch=16]                   Number of packages that are loaded ahead of validation
+//     [-GCInterval=100]                Collect garbage after this many validated packages
+//     [-Shard=0 -NumShards=1]          Only validate a deterministic subset of the blueprints, so the validation can
+//                                      be distributed between multiple processes
+//     [-IgnoreAssetRegistryTags]       Also load and validate blueprints that passed validation with the current rules
+//                                      according to their asset registry tags
+//
+// -run=OUUBlueprintValidation -MergeReports=<file>,<dir>/*.json [-JsonReport=<file>] [-JUnitReport=<file>]
+//     Merge the JSON reports of multiple shards into a single report
+UCLASS()
+class UOUUBlueprintValidationCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+public:
+	UOUUBlueprintValidationCommandlet();
+
+	// - UCommandlet
+	int32 Main(const FString& Params) override;
+	// --
+};
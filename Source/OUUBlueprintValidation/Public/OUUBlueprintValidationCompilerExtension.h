@@ -3,13 +3,26 @@
 #pragma once
 
 #include "BlueprintCompilerExtension.h"
+#include "OUUBlueprintDiagnostics.h"
 
 #include "OUUBlueprintValidationCompilerExtension.generated.h"
 
+class UBlueprint;
+
 UCLASS()
 class UOUUBlueprintValidationCompilerExtension : public UBlueprintCompilerExtension
 {
 	GENERATED_BODY()
+public:
+	// Run all validations of compiled blueprints except maintainability and disallowed nodes.
+	// Findings on individual nodes are also shown on the nodes, like the messages of the compiler itself.
+	// Only called after the asynchronous maintainability validation (see
+	// ValidateMaintainabilityAsynchronouslyOnCompile), never during compilation.
+	static void ValidateCompiledBlueprint(
+		const UBlueprint& Blueprint,
+		TFunctionRef<void(const OUU::BlueprintValidation::FDiagnostic&)> DiagnosticFunction,
+		bool LogMetrics);
+
 protected:
 	void ProcessBlueprintCompiled(const FKismetCompilerContext& CompilationContext, const FBlueprintCompiledData& Data)
 		override;
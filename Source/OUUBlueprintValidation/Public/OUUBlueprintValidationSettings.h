@@ -27,6 +27,15 @@ FORCEINLINE EMessageSeverity::Type ToMessageSeverity(EOUUBlueprintValidationSeve
 	}
 }
 
+UENUM()
+enum class EOUUCyclomaticComplexityMode
+{
+	// Lenient counting of execution paths (see README)
+	Galea,
+	// True McCabe cyclomatic complexity of the exec flow graph: E - N + 2P
+	McCabe
+};
+
 UCLASS(Config = Editor, DefaultConfig)
 class UOUUBlueprintValidationSettings : public UDeveloperSettings
 {
@@ -46,10 +55,145 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Validation")
 	EOUUBlueprintValidationSeverity CheckDisallowedFunctions = EOUUBlueprintValidationSeverity::Warning;
 
-	// Function paths, and reasons why they are disallowed
+	// Function paths, and reasons why they are disallowed.
+	// Paths may contain * and ? wildcards in the class and function name, e.g.
+	// /Script/Engine.KismetSystemLibrary:*Blocking* or /Script/Engine.KismetSystemLibrary:* for a whole class.
 	UPROPERTY(Config, EditAnywhere, CategorY = "Blueprint Validation")
 	TMap<FString, FString> DisallowedFunctionPaths;
 
+	// Check for calls of the functions below in nodes that are executed every frame.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Per-Frame Validation")
+	EOUUBlueprintValidationSeverity CheckPerFrameFunctions = EOUUBlueprintValidationSeverity::Warning;
+
+	// Events and overridden functions that are executed every frame.
+	// Looping timers and UMG property bindings are always considered per-frame entry points.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Per-Frame Validation")
+	TArray<FName> PerFrameEventNames = {
+		TEXT("ReceiveTick"),
+		TEXT("Tick"),
+		TEXT("OnPaint"),
+		TEXT("BlueprintUpdateAnimation"),
+		TEXT("BlueprintThreadSafeUpdateAnimation"),
+		TEXT("ReceiveTickAI")};
+
+	// Function paths that are disallowed in per-frame code, and reasons why they are disallowed.
+	// Same format as DisallowedFunctionPaths. These functions are only flagged if they are reachable from one of the
+	// per-frame events, so the list can be a lot stricter.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Per-Frame Validation")
+	TMap<FString, FString> DisallowedPerFrameFunctionPaths = {
+		{TEXT("/Script/Engine.GameplayStatics:GetAllActors*"), TEXT("Iterates all actors of the world")},
+		{TEXT("/Script/Engine.GameplayStatics:GetActorOfClass"), TEXT("Iterates all actors of the world")},
+		{TEXT("/Script/UMG.WidgetBlueprintLibrary:GetAllWidgets*"), TEXT("Iterates all widgets")},
+		{TEXT("/Script/Engine.KismetSystemLibrary:*_Blocking"), TEXT("Blocking load causes hitches")},
+		{TEXT("/Script/Engine.KismetTextLibrary:Format"), TEXT("Text formatting allocates every frame")},
+		{TEXT("/Script/Engine.KismetStringLibrary:BuildString_*"), TEXT("String building allocates every frame")},
+		{TEXT("/Script/Engine.KismetStringLibrary:Concat_StrStr"), TEXT("String concatenation allocates every frame")}};
+
+	// Check how often pure function calls are evaluated. Pure nodes are evaluated again for every impure node that
+	// consumes them and on every loop iteration.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Pure Re-Evaluation")
+	EOUUBlueprintValidationSeverity CheckPureReevaluation = EOUUBlueprintValidationSeverity::Warning;
+
+	// Loops can't be evaluated statically, so every loop (loop macros like ForEachLoop or exec cycles in a graph) is
+	// assumed to run this many iterations.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Pure Re-Evaluation", meta = (ClampMin = 1, UIMax = 100))
+	int32 AssumedLoopIterations = 10;
+
+	// Maximum estimated number of evaluations of a pure function call per execution of its graph
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Pure Re-Evaluation", meta = (ClampMin = 1, UIMax = 100))
+	int32 MaxPureFunctionEvaluations = 5;
+
+	// Function paths of pure functions that are cheap enough to be evaluated any number of times.
+	// Same format as DisallowedFunctionPaths.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Pure Re-Evaluation")
+	TArray<FString> CheapPureFunctionPaths = {
+		TEXT("/Script/Engine.KismetMathLibrary:*"),
+		TEXT("/Script/Engine.KismetArrayLibrary:Array_Get"),
+		TEXT("/Script/Engine.KismetArrayLibrary:Array_Length"),
+		TEXT("/Script/Engine.KismetArrayLibrary:Array_LastIndex"),
+		TEXT("/Script/Engine.KismetArrayLibrary:Array_IsValidIndex"),
+		TEXT("/Script/Engine.KismetSystemLibrary:IsValid*")};
+
+	// Check how deeply loops are nested in each graph, including loops in macros, collapsed graphs and called
+	// functions of the same blueprint. The cost of a graph with loops nested N levels deep grows with O(n^N).
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Loop Nesting")
+	EOUUBlueprintValidationSeverity CheckLoopNesting = EOUUBlueprintValidationSeverity::Warning;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Loop Nesting", meta = (ClampMin = 1, UIMax = 5))
+	int32 MaxLoopNestingDepth = 2;
+
+	// Check the per-frame cost of widget blueprints: Property bindings and Tick overrides are evaluated every frame.
+	UPROPERTY(Config, EditAnywhere, Category = "Widget Bindings")
+	EOUUBlueprintValidationSeverity CheckWidgetBindings = EOUUBlueprintValidationSeverity::Warning;
+
+	// Maximum number of property bindings and Tick overrides per widget blueprint
+	UPROPERTY(Config, EditAnywhere, Category = "Widget Bindings", meta = (UIMin = 0, UIMax = 50))
+	int32 MaxPerFrameWidgetUpdates = 10;
+
+	// Maximum node count of each function that is bound to a widget property
+	UPROPERTY(Config, EditAnywhere, Category = "Widget Bindings", meta = (UIMin = 0, UIMax = 50))
+	int32 MaxWidgetBindingNodeCount = 10;
+
+	// Maximum cyclomatic complexity of each function that is bound to a widget property
+	UPROPERTY(Config, EditAnywhere, Category = "Widget Bindings", meta = (UIMin = 1, UIMax = 10))
+	int32 MaxWidgetBindingCyclomaticComplexity = 2;
+
+	// Check all packages that are loaded together with each blueprint, i.e. the transitive closure of its runtime hard
+	// references. This is computed from asset registry data of the saved packages without loading any of them.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Reference Footprint")
+	EOUUBlueprintValidationSeverity CheckReferenceFootprint = EOUUBlueprintValidationSeverity::Warning;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Reference Footprint", meta = (UIMin = 0, UIMax = 2000))
+	int32 MaxReferencedPackages = 500;
+
+	// Maximum size on disk of all referenced packages. The asset registry has no information about the loaded size of
+	// assets, so this is also used as the estimate of the memory needed to load them.
+	UPROPERTY(
+		Config,
+		EditAnywhere,
+		Category = "Blueprint Reference Footprint",
+		meta = (ClampMin = 0, UIMax = 1000, Units = "Megabytes"))
+	int32 MaxReferencedSizeMB = 200;
+
+	// Maximum size on disk of referenced assets of specific classes (including child classes), e.g. textures or sounds
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Reference Footprint")
+	TMap<TSoftClassPtr<UObject>, int32> MaxReferencedSizePerAssetClassMB;
+
+	// Number of reference chains to the heaviest referenced packages that are reported when a budget is exceeded
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Reference Footprint", meta = (ClampMin = 0, UIMax = 10))
+	int32 NumReportedReferenceChains = 3;
+
+	// Check the memory and components that every instance of the generated class carries. Actors that are spawned in
+	// large numbers multiply every byte and component.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Instance Footprint")
+	EOUUBlueprintValidationSeverity CheckInstanceFootprint = EOUUBlueprintValidationSeverity::Warning;
+
+	// Maximum bytes a blueprint adds to every instance on top of its parent class: Variables, the local state of the
+	// event graphs and the default elements of arrays, sets and maps
+	UPROPERTY(
+		Config,
+		EditAnywhere,
+		Category = "Blueprint Instance Footprint",
+		meta = (ClampMin = 0, UIMax = 16384, Units = "Bytes"))
+	int32 MaxInstanceBytesAddedByBlueprint = 4096;
+
+	// Maximum number of components of every actor instance, including components of parent classes
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Instance Footprint", meta = (ClampMin = 0, UIMax = 100))
+	int32 MaxComponentsPerInstance = 30;
+
+	// Should the compile duration, bytecode size and node count of every compiled blueprint be logged to
+	// Saved/OUUBlueprintValidation/CompileProfile.csv? See console command OUUBlueprintValidation.CompileProfileReport.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Compile Profiling")
+	bool ProfileBlueprintCompilation = false;
+
+	// The compile profile log is moved to CompileProfile-Previous.csv once it exceeds this size.
+	UPROPERTY(
+		Config,
+		EditAnywhere,
+		Category = "Blueprint Compile Profiling",
+		meta = (ClampMin = 1, Units = "Kilobytes"))
+	int32 MaxCompileProfileLogSizeKB = 4096;
+
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall")
 	EOUUBlueprintValidationSeverity CheckMaintainabilityMetrics = EOUUBlueprintValidationSeverity::Warning;
 
@@ -57,6 +201,19 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall")
 	bool LogMetricsOnBlueprintCompile = false;
 
+	// Should maintainability be validated on a background task after blueprint compilation?
+	// Compilation finishes without waiting for the metric analysis and the results are added to the compiler results
+	// when they are ready. Then the performance checks (per-frame calls, pure re-evaluation, loop nesting, bytecode
+	// cost, instance footprint and widget bindings) are also run on compile. Synchronous compile validation only
+	// checks maintainability and disallowed nodes.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall")
+	bool ValidateMaintainabilityAsynchronouslyOnCompile = false;
+
+	// Should the metrics of the focused graph be displayed in the blueprint editor toolbar?
+	// They are updated incrementally while the graph is edited.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall")
+	bool ShowLiveMetricsInBlueprintEditor = true;
+
 	// Should info messages for BP maintainability be sent to the message log independent of validation result?
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall")
 	bool LogMetricsOnAssetValidate = false;
@@ -66,6 +223,11 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall")
 	FString MaintainabilityDocumentationURL;
 
+	// Should graph metrics be stored in the derived data cache, so unchanged graphs don't have to be analyzed again in
+	// later editor sessions or on other machines that share the DDC?
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall")
+	bool UsePersistentMetricsCache = true;
+
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Overall", meta = (UIMin = 0, UIMax = 200))
 	int32 MaxGraphsPerBlueprint = 100;
 
@@ -85,6 +247,11 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Per Graph", meta = (UIMin = 0, UIMax = 100))
 	int32 MaxCyclomaticComplexityPerGraph = 40;
 
+	// Which cyclomatic complexity is checked against MaxCyclomaticComplexityPerGraph and used for the maintainability
+	// index. Both values are always computed and logged, so they can be compared.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Per Graph")
+	EOUUCyclomaticComplexityMode CyclomaticComplexityMode = EOUUCyclomaticComplexityMode::Galea;
+
 	UPROPERTY(
 		Config,
 		EditAnywhere,
@@ -95,4 +262,30 @@ public:
 	// Only evaluate comment percentage if this number of nodes in the graph is reached or surpassed
 	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Maintainability - Per Graph", meta = (UIMin = 0, UIMax = 100))
 	int32 MinNumberOfNodesToConsiderComments = 20;
+
+	// Check the estimated VM cost of the compiled bytecode of each blueprint function against the budgets below.
+	// The estimation is static, i.e. every instruction is counted once independent of loops and branches.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Bytecode Cost")
+	EOUUBlueprintValidationSeverity CheckBytecodeCost = EOUUBlueprintValidationSeverity::DoNotValidate;
+
+	// All events of the event graphs are compiled into a single function, which is usually a lot bigger than other
+	// functions. If false, event graphs are excluded from the budgets below.
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Bytecode Cost")
+	bool IncludeEventGraphsInBytecodeBudgets = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Bytecode Cost", meta = (UIMin = 0, UIMax = 5000))
+	int32 MaxBytecodeInstructionsPerFunction = 1000;
+
+	// Expressions evaluated in the context of another object, e.g. function calls on or property access of other
+	// objects
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Bytecode Cost", meta = (UIMin = 0, UIMax = 500))
+	int32 MaxBytecodeContextSwitchesPerFunction = 100;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Bytecode Cost", meta = (UIMin = 0, UIMax = 500))
+	int32 MaxBytecodeFunctionCallsPerFunction = 150;
+
+	// Arrays, sets and maps that are copied by value, i.e. assigned as a whole or passed to / returned from functions
+	// without reference
+	UPROPERTY(Config, EditAnywhere, Category = "Blueprint Bytecode Cost", meta = (UIMin = 0, UIMax = 50))
+	int32 MaxContainerCopiesPerFunction = 5;
 };